@@ -26,4 +26,11 @@ protected:
 
   /// Maximum number of active slip systems for the crystalline material being modeled
   const unsigned int _number_slip_systems;
+
+  /// Store the slip rate directly in one array variable filled in a single pass
+  /// instead of one variable and one auxkernel for each slip system
+  const bool _array_variables;
+
+  /// Name of the slip rate array variable whose gradient is taken
+  const std::string _slip_rate_vector_name;
 };
@@ -20,6 +20,11 @@ public:
   virtual void act();
 
 protected:
+  /// Add the auxvariables for material property prop_name
+  void addDislocationVariables(const std::string & prop_name);
+
+  /// Add the auxkernels storing material property prop_name
+  void addDislocationAuxKernels(const std::string & prop_name);
 
   /// base name for the auxiliary variables
   const std::string _base_name;
@@ -32,4 +37,8 @@ protected:
   const bool _rho_gnd_edge;
   const bool _rho_gnd_screw;
   const bool _slip_resistance;
+
+  /// Store each field in one array variable filled in a single pass
+  /// instead of one variable and one auxkernel for each slip system
+  const bool _array_variables;
 };
@@ -11,6 +11,8 @@
 
 // Calculate directional derivative along edge and screw dislocation propagation direction.
 // This AuxKernel applies to a vector auxiliary variable
+// If screw_variable is given, the edge derivative is stored in variable
+// and the screw derivative in screw_variable, both calculated in one element pass
 
 class ArrayDirectionalDerivative : public ArrayAuxKernel
 {
@@ -23,9 +25,16 @@ public:
    */
   ArrayDirectionalDerivative(const InputParameters & parameters);
 
+  virtual void compute() override;
+
 protected:
   virtual RealEigenVector computeValue() override;
 
+  // Calculate the directional derivative at _qp
+  // and store it in _derivative, and the screw one
+  // in _screw_derivative if screw_variable is given
+  void computeDirectionalDerivative();
+
 private:
 
   // The vector variable from which to compute the directional derivative
@@ -40,7 +49,19 @@ private:
   // Character of dislocations (edge or screw)
   const enum class DisloCharacter { edge, screw } _dislo_character;
   
-  // advection velocity
-  std::vector<Real> _velocity;
+  // Optional variable storing the screw derivative
+  // while variable stores the edge derivative
+  ArrayMooseVariable * const _screw_var;
+  
+  // Directional derivative at _qp on all slip systems
+  RealEigenVector _derivative;
+
+  // Screw directional derivative at _qp on all slip systems
+  RealEigenVector _screw_derivative;
+
+  // Volume average of the directional derivatives
+  // for CONSTANT MONOMIAL variables
+  RealEigenVector _average_derivative;
+  RealEigenVector _average_screw_derivative;
 
 };
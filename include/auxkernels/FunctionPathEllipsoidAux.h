@@ -5,6 +5,7 @@
 #pragma once
 
 #include "AuxKernel.h"
+#include "Toolpath.h"
 
 class Function;
 
@@ -46,4 +47,16 @@ protected:
   // that activates the level set.
   const Real _level_set_activation_threshold;
 
+  /// The ellipsoid function is larger than the threshold
+  /// where the exponent is smaller than this value
+  const Real _activation_exponent;
+
+  /// Optional toolpath providing position and power of the source:
+  /// the level set is activated only when the power is on
+  const Toolpath * const _toolpath;
+
+  /// Centre of the source and source on/off, updated once per time
+  Point _center;
+  bool _source_on;
+  Real _center_time;
 };
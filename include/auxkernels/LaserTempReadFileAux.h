@@ -6,6 +6,7 @@
 
 #include "AuxKernel.h"
 #include "LaserTempReadFile.h"
+#include "MeltingPhaseTimeline.h"
 
 // Read temperature due to laser scan during SLM from CFD simulation
 
@@ -27,8 +28,9 @@ protected:
   /// The LaserTempReadFile GeneralUserObject to read element specific temperature values from file
   const LaserTempReadFile * const _temperature_read_user_object;
   
-  /// Time interval between two temperature data field
-  const Real _temperature_time_step;
+  /// Optional precomputed phase of each element at each temperature time step,
+  /// its melting and gas temperatures are used
+  const MeltingPhaseTimeline * const _phase_timeline;
 
   const Real _melting_temperature_high;
   const Real _melting_temperature_low;
@@ -38,14 +40,10 @@ protected:
   const Real _reference_temperature;
   
   bool _degrade_eigenstrain;
-  
-  /// Number of temperature data field in time
-  /// if the variable temperature_step becomes bigger than the
-  /// total number of temperature time steps, the temperature
-  /// is kept constant, element by element, at the last read
-  /// temperature time step
-  const unsigned int _temperature_num_step;
 
   virtual Real computeValue();
 
+  /// Solid phase of a temperature value limited in the interval gas to liquidus
+  bool isSolidTemperature(const Real temperature) const;
+
 };
@@ -0,0 +1,27 @@
+// Nicolò Grilli
+// Università di Bristol
+// 18 Ottobre 2026
+
+#pragma once
+
+#include "AuxKernel.h"
+
+/**
+ * Store all components of a std::vector<Real> material property,
+ * for instance a dislocation density on all slip systems,
+ * into an array auxiliary variable in a single pass.
+ * This replaces one MaterialStdVectorAux for each component.
+ */
+class MaterialStdVectorArrayAux : public ArrayAuxKernel
+{
+public:
+  static InputParameters validParams();
+
+  MaterialStdVectorArrayAux(const InputParameters & parameters);
+
+protected:
+  virtual RealEigenVector computeValue() override;
+
+  /// Material property with one component for each component of the array variable
+  const MaterialProperty<std::vector<Real>> & _prop;
+};
@@ -29,9 +29,6 @@ protected:
   /// The LaserTempReadFile GeneralUserObject to read element specific temperature values from file
   const LaserTempReadFile * const _temperature_read_user_object;
   
-  /// Time interval between two temperature data field
-  const Real _temperature_time_step;
-
   const Real _melting_temperature_high;
   const Real _melting_temperature_low;
   const Real _gas_temperature_high;
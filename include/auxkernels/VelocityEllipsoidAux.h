@@ -7,12 +7,11 @@
 #pragma once
 
 #include "AuxKernel.h"
-
-class Function;
+#include "ScanStrategy.h"
 
 /**
  * This AuxKernel increases an AuxVariable from 0 to 1 if the qp is inside
- * an ellipsoid that is moving according to paths defined by velocity and initial coordinates.
+ * an ellipsoid that is moving according to the tracks of a ScanStrategy user object.
  * It can be applied to a level set variable
  * to simulate the material deposition during wire arc additive manufacturing (WAAM)
  * together with ActDeactElementsCoupled.
@@ -40,33 +39,16 @@ protected:
   /// longitudinal ellipsoid axe
   const Real _rz;
 
-  /// Velocity vector of the material deposition source
-  const RealVectorValue _velocity;
-
-  /// Initial values of the coordinates of the material deposition source
-  /// Every time the postprocessor condition is satisfied, 
-  /// the heat source is moved to the next set of coordinates
-  const std::vector<Real> _init_x_coords;
-  const std::vector<Real> _init_y_coords;
-  const std::vector<Real> _init_z_coords;
-  
-  /// Total length during each scan
-  /// After the laser has travelled this length
-  /// it is switched off
-  const std::vector<Real> _scan_length;
-
   /// Threshold value of the ellipsoid function
   /// that activates the level set.
   const Real _level_set_activation_threshold;
-  
-  /// _t_scan tracks the simulation time at which a new
-  /// scan begins after the condition based on the postprocessor
-  /// changes the coordinates of the heat source
-  /// imported from a VelocityEllipsoidHeatSource material object
-  const MaterialProperty<Real> & _t_scan;
-  
-  /// Material deposition track index
-  /// imported from a VelocityEllipsoidHeatSource material object
-  const MaterialProperty<int> & _n_track;
+
+  /// The ellipsoid function is larger than the threshold
+  /// where the exponent is smaller than this value
+  const Real _activation_exponent;
+
+  /// Scan strategy with the global track index and scan start time
+  /// shared with the VelocityEllipsoidHeatSource material object
+  const ScanStrategy & _scan_strategy;
 
 };
@@ -31,6 +31,10 @@
  *      are interpolated from the reconstructed linear polynomials
  *      in the "left" and "right "element, respectively,
  *      which are provided from the corresponding material kernel.
+ *
+ *   5. Flux and Jacobian matrices are evaluated once per quadrature point
+ *      of the current face into reusable buffers, and reused
+ *      for all test and shape functions.
  */
 class CAEFVKernel : public DGKernel
 {
@@ -40,9 +44,19 @@ public:
   CAEFVKernel(const InputParameters & parameters);
   virtual ~CAEFVKernel();
 
+  virtual void computeResidual() override;
+  virtual void computeJacobian() override;
+  virtual void computeOffDiagJacobian(unsigned int jvar) override;
+
 protected:
-  virtual Real computeQpResidual(Moose::DGResidualType type);
-  virtual Real computeQpJacobian(Moose::DGJacobianType type);
+  virtual Real computeQpResidual(Moose::DGResidualType type) override;
+  virtual Real computeQpJacobian(Moose::DGJacobianType type) override;
+
+  /// evaluate the flux at all quadrature points of the current face
+  void computeFaceFlux();
+
+  /// evaluate the flux Jacobian at all quadrature points of the current face
+  void computeFaceFluxJacobian();
 
   /// choose an equation
   MooseEnum _component;
@@ -60,4 +74,16 @@ protected:
 
   /// flux user object
   const InternalSideFluxBase & _flux;
+
+  /// reusable "left" and "right" state vectors
+  std::vector<Real> _uvec1;
+  std::vector<Real> _uvec2;
+
+  /// flux at the quadrature points of the current face
+  std::vector<Real> _face_flux;
+
+  /// flux Jacobian with respect to the "left" and "right" states
+  /// at the quadrature points of the current face
+  std::vector<Real> _face_fjac1;
+  std::vector<Real> _face_fjac2;
 };
@@ -13,9 +13,9 @@
 
 #pragma once
 
-#include "DGKernel.h"
+#include "DGDislocationAdvectionBase.h"
 
-class DGAdvectionCoupled : public DGKernel
+class DGAdvectionCoupled : public DGDislocationAdvectionBase
 {
 public:
   static InputParameters validParams();
@@ -15,9 +15,9 @@
 
 #pragma once
 
-#include "DGKernel.h"
+#include "DGDislocationAdvectionBase.h"
 
-class DGAdvectionCoupledAvg : public DGKernel
+class DGAdvectionCoupledAvg : public DGDislocationAdvectionBase
 {
 public:
   static InputParameters validParams();
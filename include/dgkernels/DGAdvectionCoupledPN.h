@@ -17,9 +17,9 @@
 
 #pragma once
 
-#include "DGKernel.h"
+#include "DGDislocationAdvectionBase.h"
 
-class DGAdvectionCoupledPN : public DGKernel
+class DGAdvectionCoupledPN : public DGDislocationAdvectionBase
 {
 public:
   static InputParameters validParams();
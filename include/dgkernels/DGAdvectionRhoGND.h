@@ -18,15 +18,24 @@
 
 #pragma once
 
-#include "DGKernel.h"
+#include "DGDislocationAdvectionBase.h"
 
-class DGAdvectionRhoGND : public DGKernel
+class DGAdvectionRhoGND : public DGDislocationAdvectionBase
 {
 public:
   static InputParameters validParams();
 
   DGAdvectionRhoGND(const InputParameters & parameters);
 
+  // Split the GND density of this character into positive and negative densities
+  // given the squared total density remaining after subtraction of "other type" GND.
+  // Returns false if rho_tot < sqrt(rho_e^2 + rho_s^2).
+  // Also used by DislocationPositivityLimiter
+  static bool decomposeGND(const Real remain_rho_tot,
+                           const Real rho_coupled,
+                           Real & rho_gnd_pos,
+                           Real & rho_gnd_neg);
+
 protected:
   virtual void getDislocationVelocity();
   virtual Real computeQpResidual(Moose::DGResidualType type) override;
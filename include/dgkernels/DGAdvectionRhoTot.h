@@ -18,9 +18,9 @@
 
 #pragma once
 
-#include "DGKernel.h"
+#include "DGDislocationAdvectionBase.h"
 
-class DGAdvectionRhoTot : public DGKernel
+class DGAdvectionRhoTot : public DGDislocationAdvectionBase
 {
 public:
   static InputParameters validParams();
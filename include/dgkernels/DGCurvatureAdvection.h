@@ -6,9 +6,9 @@
 
 #pragma once
 
-#include "DGKernel.h"
+#include "DGDislocationAdvectionBase.h"
 
-class DGCurvatureAdvection : public DGKernel
+class DGCurvatureAdvection : public DGDislocationAdvectionBase
 {
 public:
   static InputParameters validParams();
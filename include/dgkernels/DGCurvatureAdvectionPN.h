@@ -16,9 +16,9 @@
 
 #pragma once
 
-#include "DGKernel.h"
+#include "DGDislocationAdvectionBase.h"
 
-class DGCurvatureAdvectionPN : public DGKernel
+class DGCurvatureAdvectionPN : public DGDislocationAdvectionBase
 {
 public:
   static InputParameters validParams();
@@ -0,0 +1,43 @@
+// Nicolò Grilli
+// Università di Bristol
+// 18 Ottobre 2026
+
+// Base class for DG upwinding of dislocation densities
+// advected with the dislocation velocity of slip system slip_sys_index.
+// If an activity_map user object is given, internal faces
+// on which dislocations cannot move are skipped:
+// - if the dislocation velocity is zero at all the face quadrature points,
+//   residual and Jacobian contributions are both zero and are skipped
+// - if the variable and all the coupled variables are zero
+//   at all the face quadrature points on both sides,
+//   only the residual contribution is zero and is skipped,
+//   the Jacobian is still computed
+// The activity of each face is computed once per nonlinear iteration
+// by the activity map, which must check all the variables of the kernel.
+// The sparsity pattern is not affected because it is
+// defined by the DoF map and not by the assembled entries.
+
+#pragma once
+
+#include "DGKernel.h"
+
+class DislocationActivityMap;
+
+class DGDislocationAdvectionBase : public DGKernel
+{
+public:
+  static InputParameters validParams();
+
+  DGDislocationAdvectionBase(const InputParameters & parameters);
+
+  virtual void computeResidual() override;
+  virtual void computeJacobian() override;
+  virtual void computeOffDiagJacobian(unsigned int jvar) override;
+
+protected:
+  // User object storing the activity of each internal face
+  const DislocationActivityMap * const _activity_map;
+
+  // Slip system index used to check the activity
+  const unsigned int _activity_slip_sys_index;
+};
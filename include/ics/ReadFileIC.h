@@ -5,7 +5,9 @@
 #pragma once
 
 #include "InitialCondition.h"
-#include "DelimitedFileReader.h"
+#include "StructuredGridData.h"
+
+class StructuredGridReadFile;
 
 class InputParameters;
 
@@ -15,6 +17,11 @@ InputParameters validParams();
 /**
  * Defines a boundary condition that is read from file
  * and assigned to the nodes of a structured mesh
+ * The file can be read once by a StructuredGridReadFile
+ * shared by the initial conditions of all the phase fields,
+ * otherwise each initial condition reads it.
+ * Structured grids can be 3D and values can be interpolated trilinearly
+ * on meshes that do not match the grid.
  */
 class ReadFileIC : public InitialCondition
 {
@@ -51,15 +58,23 @@ protected:
   const Real _element_size_x;
   const Real _element_size_y;
   
-  /// Number of elements along the x and y axes in the structured mesh
+  /// Number of elements along the x, y and z axes in the structured mesh
   const unsigned int _nx;
   const unsigned int _ny;
+  const unsigned int _nz;
 
   /// Phase field index used to select the column in the file
   /// and total number of phase fields
   const unsigned int _op;
   const unsigned int _op_num;
-  
+
+  /// Shared structured grid data, nullptr if the file is read by this initial condition
+  const StructuredGridReadFile * const _grid_data_user_object;
+
   /// Data structure to store the information in the IC file
-  std::vector<std::vector<Real>> _IC_data;
+  /// if it is not shared
+  std::unique_ptr<StructuredGridData> _IC_data;
+
+  /// Structured grid data used by this initial condition
+  const StructuredGridData * _grid_data;
 };
@@ -0,0 +1,69 @@
+// Nicolò Grilli
+// Università di Bristol
+// 18 Ottobre 2026
+
+#pragma once
+
+#include "QuadraturePointMarker.h"
+#include "HeatSourcePosition.h"
+
+/**
+ * Marker following the melt pool of a moving ellipsoidal heat source.
+ * Quadrature points within refine_distance (in units of the ellipsoid radii)
+ * of the path travelled by the source during the next lead_time are refined,
+ * quadrature points farther than coarsen_distance behind or away from the source
+ * are coarsened if the temperature gradient is low.
+ * The source position is given by path functions, as in FunctionPathEllipsoidMaterial,
+ * by a ScanStrategy, as in VelocityEllipsoidHeatSource, or by a Toolpath.
+ * Elements whose siblings belong to a different subdomain are not coarsened,
+ * so that element activation by ActDeactElementsUserObjectBase is preserved.
+ * Stateful material properties are projected by the adaptivity system.
+ */
+class HeatSourceMarker : public QuadraturePointMarker
+{
+public:
+  static InputParameters validParams();
+
+  HeatSourceMarker(const InputParameters & parameters);
+
+protected:
+  virtual MarkerValue computeElementMarker() override;
+  virtual MarkerValue computeQpMarker() override;
+
+  /// Update the path of the source during the next lead time
+  void updateSourcePath();
+
+  /// Scaled distance between a point and the path of the source
+  Real scaledDistance(const Point & p) const;
+
+  /// Ellipsoid radii
+  const RealVectorValue _radii;
+
+  /// Refine within this scaled distance from the source
+  const Real _refine_distance;
+
+  /// Coarsen beyond this scaled distance from the source
+  const Real _coarsen_distance;
+
+  /// Time ahead of the source that is refined
+  const Real _lead_time;
+
+  /// Refine where the temperature gradient is larger than this value
+  const Real _refine_gradient;
+
+  /// Coarsen only where the temperature gradient is smaller than this value
+  const Real _coarsen_gradient;
+
+  /// Temperature gradient
+  const VariableGradient & _grad_temperature;
+
+  /// Position of the source from a scan strategy, a toolpath or path functions
+  const HeatSourcePosition _source_position;
+
+  /// Position of the source now and after the lead time,
+  /// updated once per time
+  Point _path_start;
+  Point _path_end;
+  bool _source_on;
+  Real _path_time;
+};
@@ -115,6 +115,9 @@ protected:
    */
   void calculateEigenstrainDeformationGrad();
   
+  /// Temperature at the end of the current substep
+  Real substepTemperature() const;
+
   /// Calculate the thermal eigenstrain
   virtual void calculateThermalEigenstrain(RankTwoTensor & thermal_eigenstrain);
 
@@ -236,6 +239,7 @@ protected:
   /// Crystal plasticity model of residual stress in additive manufacturing using the element elimination and reactivation method
   /// Computational Mechanics, volume 69, pages 825–845 (2022)
   const VariableValue & _temperature;
+  const VariableValue & _temperature_old;
   const Real _thermal_expansion;
   const Real _reference_temperature;
   const Real _dCTE_dT;
@@ -244,6 +248,13 @@ protected:
   const Real _melting_temperature_high;
   const Real _melting_temperature_low;
   const bool _liquid_thermal_expansion;
+
+  /// If positive, maximum temperature increment in a substep
+  /// and the temperature is interpolated in time during substepping
+  const Real _max_substep_temperature_increment;
+
+  /// Fraction of the time step completed at the end of the current substep
+  Real _substep_fraction;
   
   /// Lattice strain output
   bool _output_lattice_strain;
@@ -6,6 +6,7 @@
 
 #include "ComputeElasticityTensorCPGrain.h"
 #include "LaserTempReadFile.h"
+#include "MeltingPhaseTimeline.h"
 
 /**
  * ComputeElasticityTensorMelting defines an elasticity tensor material object for crystal plasticity.
@@ -30,6 +31,16 @@ protected:
   virtual void checkPhase();
   
   virtual void melting();
+
+  /// Set the flag of the phase from the phase timeline
+  void setPhaseFlags(const MeltingPhase phase,
+                     unsigned int & isGas,
+                     unsigned int & isSolid,
+                     unsigned int & isMushyZone) const;
+
+  /// Optional precomputed phase of each element at each temperature time step,
+  /// its melting and gas temperatures are used
+  const MeltingPhaseTimeline * const _phase_timeline;
   
   const Real _melting_temperature_high;
   const Real _melting_temperature_low;
@@ -49,20 +60,14 @@ protected:
   /// The LaserTempReadFile GeneralUserObject to read element specific temperature values from file
   const LaserTempReadFile * const _temperature_read_user_object;
   
-  /// Time interval between two temperature data field
-  const Real _temperature_time_step;
-  
-  /// Number of temperature data field in time
-  /// if the variable temperature_step becomes bigger than the
-  /// total number of temperature time steps, the temperature
-  /// is kept constant, element by element, at the last read
-  /// temperature time step
-  const unsigned int _temperature_num_step;
-  
   /// Using the element activation feature
   /// Elements must be activated with degraded stiffness
   bool _activate_elems;  
 
+  /// Element and time of the last phase check
+  dof_id_type _phase_elem_id;
+  Real _phase_time;
+
   /// Stiffness tensor modified by melting
   /// to model laser scanning
   RankFourTensor _Melt_Cijkl;
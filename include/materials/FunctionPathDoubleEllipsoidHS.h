@@ -6,6 +6,8 @@
 #pragma once
 
 #include "Material.h"
+#include "HeatSourceCulling.h"
+#include "Toolpath.h"
 
 class Function;
 
@@ -23,6 +25,7 @@ public:
   FunctionPathDoubleEllipsoidHS(const InputParameters & parameters);
 
 protected:
+  virtual void computeProperties() override;
   virtual void computeQpProperties() override;
 
   /// power
@@ -48,5 +51,16 @@ protected:
   const Function & _function_y;
   const Function & _function_z;
 
+  /// Optional toolpath providing position and power of the heat source
+  const Toolpath * const _toolpath;
+
   ADMaterialProperty<Real> & _volumetric_heat;
+
+  /// Elements far from the heat source are skipped
+  HeatSourceCulling _culling;
+
+  /// Centre and power of the heat source, updated once per time
+  Point _center;
+  Real _power;
+  Real _center_time;
 };
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "Material.h"
+#include "HeatSourceCulling.h"
 
 /**
  * This class increases a material property from 0 to 1 if the element is inside an ellipsoid
@@ -19,6 +20,8 @@ public:
 protected:
   virtual void initQpStatefulProperties() override;
 
+  virtual void computeProperties() override;
+
   virtual void computeQpProperties() override;
 
   /// Base name prepended to material property name
@@ -47,5 +50,16 @@ protected:
 
   MaterialProperty<Real> & _level_set;
   const MaterialProperty<Real> & _level_set_old;
-  
+
+  // The ellipsoid function is larger than the threshold
+  // where the exponent is smaller than this value
+  const Real _activation_exponent;
+
+  /// Elements far from the heat source are not activated
+  HeatSourceCulling _culling;
+
+  /// Centre of the heat source, updated once per time
+  Point _center;
+  Real _center_time;
+
 };
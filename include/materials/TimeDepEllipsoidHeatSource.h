@@ -5,6 +5,8 @@
 #pragma once
 
 #include "FunctionPathEllipsoidHeatSource.h"
+#include "HeatSourceCulling.h"
+#include "Toolpath.h"
 
 class Function;
 
@@ -20,9 +22,22 @@ public:
   TimeDepEllipsoidHeatSource(const InputParameters & parameters);
 
 protected:
+  virtual void computeProperties() override;
   virtual void computeQpProperties() override;
 
   /// The time function that is a prefactor of the space ellipsoid heat source.
   const Function & _function_t;
 
+  /// Optional toolpath providing position and power of the heat source
+  const Toolpath * const _toolpath;
+
+  /// Elements far from the heat source are skipped
+  HeatSourceCulling _culling;
+
+  /// Centre and power of the heat source and time function, updated once per time
+  Point _center;
+  Real _power;
+  Real _ramp_up_t;
+  Real _center_time;
+
 };
@@ -5,6 +5,8 @@
 #pragma once
 
 #include "ActDeactElementsUserObjectBase.h"
+#include "MeltingPhaseTimeline.h"
+#include "ActivationSchedule.h"
 
 class ActDeactElementsMelting : public ActDeactElementsUserObjectBase
 {
@@ -15,9 +17,20 @@ public:
 
   virtual bool isElementActivated() override;
 
+  void initialize() override;
+  void execute() override;
+
 protected:
   /// temperature value to decide wether an element would be activated
   const VariableValue & _temperature;
+  /// optional precomputed phase of each element at each temperature time step
+  const MeltingPhaseTimeline * const _phase_timeline;
+  /// time interval between two temperature data field, used with the phase timeline
+  const Real _temperature_time_step;
+  /// optional precomputed activation time of each element for element birth
+  const ActivationSchedule * const _activation_schedule;
+  /// a batch of the activation schedule is due in this time step
+  bool _batch_due;
   /// melting temperature above which elements are deactivated
   const Real _melting_temperature_low;
   /// gas temperature below which elements are deactivated
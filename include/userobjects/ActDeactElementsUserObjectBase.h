@@ -13,6 +13,8 @@
 #include "NonlinearSystemBase.h"
 #include "AuxiliarySystem.h"
 
+#include <unordered_set>
+
 class ActDeactElementsUserObjectBase : public ElementUserObject
 {
 public:
@@ -20,7 +22,10 @@ public:
 
   ActDeactElementsUserObjectBase(const InputParameters & parameters);
 
-  const std::set<dof_id_type> & getNewlyActivatedElements() const { return _newly_activated_elem; };
+  const std::unordered_set<dof_id_type> & getNewlyActivatedElements() const
+  {
+    return _newly_activated_elem;
+  };
 
   BoundaryID getExpandedBoundaryID()
   {
@@ -30,9 +35,10 @@ public:
 
   virtual bool isElementActivated() = 0;
 
-  void initialize() override{};
+  void initialSetup() override;
+  void initialize() override;
   void execute() override;
-  void threadJoin(const UserObject & /*uo*/) override{};
+  void threadJoin(const UserObject & uo) override;
   void finalize() override;
 
 protected:
@@ -40,6 +46,15 @@ protected:
 
   void updateBoundaryInfo(MooseMesh & mesh);
 
+  /**
+   * Synchronize the subdomain ID of the ghost elements:
+   * local elements are already up to date
+   */
+  void syncGhostSubdomainIds(MooseMesh & mesh);
+
+  /// Set the subdomain ID of the ancestors of the elements from their children
+  void syncAncestorSubdomainIds(MooseMesh & mesh);
+
   void push_boundary_side_info(
       MooseMesh & mesh,
       std::unordered_map<processor_id_type, std::vector<std::pair<dof_id_type, unsigned int>>> &
@@ -57,11 +72,16 @@ protected:
    */
   bool isNewlyActivated(const Node * node);
 
-  void getNodesToRemoveFromBnd(std::set<dof_id_type> & remove_set, std::set<dof_id_type> & add_set);
+  /**
+   * Nodes in remove_nodes that are not in add_nodes,
+   * both lists are sorted and duplicates removed first
+   */
+  void getNodesToRemoveFromBnd(std::vector<dof_id_type> & remove_nodes,
+                               std::vector<dof_id_type> & add_nodes);
 
   void insertNodeIdsOnSide(const Elem * ele,
                            const unsigned short int side,
-                           std::set<dof_id_type> & node_ids);
+                           std::vector<dof_id_type> & node_ids);
 
   /**
    * Get ranges for use with threading.
@@ -70,13 +90,20 @@ protected:
   ConstBndNodeRange * getNewlyActivatedBndNodeRange();
   ConstNodeRange * getNewlyActivatedNodeRange();
 
-  std::set<dof_id_type> _newly_activated_elem;
-  std::set<dof_id_type> _newly_activated_node;
+  /**
+   * Hash sets of the newly activated elements and nodes:
+   * membership is tested for every element connected to the nodes
+   * of the activated layer, which must not scale with the layer size
+   */
+  std::unordered_set<dof_id_type> _newly_activated_elem;
+  std::unordered_set<dof_id_type> _newly_activated_node;
+  /// Elements moved to the deactivated subdomain during this execution
+  std::unordered_set<dof_id_type> _newly_deactivated_elem;
   /**
    * Somes nodes are to be removed from the boundary
    * when adding/removing sides
    */
-  std::set<dof_id_type> _node_to_remove_from_bnd;
+  std::vector<dof_id_type> _node_to_remove_from_bnd;
 
   /**
    * Ranges for use with threading.
@@ -95,4 +122,10 @@ protected:
   const std::vector<BoundaryName> _expand_boundary_name;
   /// expanded boundary IDs
   std::vector<BoundaryID> _boundary_ids, _disp_boundary_ids;
+  /**
+   * Nonlinear variables are block-restricted to the active subdomain:
+   * DoFs are added only as elements activate and DoFs shared
+   * with elements that were already active keep their old values
+   */
+  const bool _restrict_to_active_subdomain;
 };
@@ -0,0 +1,77 @@
+// Nicolò Grilli
+// Università di Bristol
+// 18 Ottobre 2026
+
+#pragma once
+
+#include "GeneralUserObject.h"
+#include "MeltingPhaseTimeline.h"
+#include "Toolpath.h"
+
+#include <limits>
+
+/**
+ * Activation time of every element for element birth,
+ * precomputed once either from the temperature history
+ * (first temperature step at which the element is solid)
+ * or from a toolpath (first time at which the element centroid
+ * is inside the deposition ellipsoid while the power is on).
+ * The distinct activation times are sorted, so that the element activation
+ * user object visits the elements only in the time steps in which
+ * at least one of them is activated, a whole layer in a single mesh update.
+ * With adaptivity, elements take the activation time of their level 0 ancestor.
+ * Must be listed after the MeltingPhaseTimeline or Toolpath in the input file.
+ */
+class ActivationSchedule : public GeneralUserObject
+{
+public:
+  static InputParameters validParams();
+
+  ActivationSchedule(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override {}
+  virtual void finalize() override {}
+
+  /// Activation time of the element, the maximum Real if it is never activated
+  Real activationTime(const Elem * elem) const;
+
+  /// The element has an activation time
+  bool isScheduled(const Elem * elem) const
+  {
+    return activationTime(elem) < std::numeric_limits<Real>::max();
+  }
+
+  /// At least one element is activated in the time interval (t_begin, t_end]
+  bool hasActivation(const Real t_begin, const Real t_end) const;
+
+protected:
+  /// Activation time from the first solid temperature step
+  void scheduleFromTimeline();
+
+  /// Activation time from the first time the deposition ellipsoid reaches the centroid
+  void scheduleFromToolpath();
+
+  /// Sort the distinct activation times
+  void buildActivationTimes();
+
+  /// Optional precomputed phase of each element at each temperature time step
+  const MeltingPhaseTimeline * const _phase_timeline;
+
+  /// Time interval between two temperature data field, used with the phase timeline
+  const Real _temperature_time_step;
+
+  /// Optional toolpath of the deposition head
+  const Toolpath * const _toolpath;
+
+  /// Radii of the deposition ellipsoid
+  const RealVectorValue _deposition_radii;
+
+  MooseMesh & _mesh;
+
+  /// Activation time indexed by level 0 element ID
+  std::vector<Real> _activation_time;
+
+  /// Distinct activation times, sorted
+  std::vector<Real> _activation_times;
+};
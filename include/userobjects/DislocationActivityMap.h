@@ -0,0 +1,70 @@
+// Nicolò Grilli
+// Università di Bristol
+// 18 Ottobre 2026
+
+#pragma once
+
+#include "InternalSideUserObject.h"
+
+/**
+ * Internal side user object that stores, for each internal face of the local elements,
+ * on which slip systems the dislocation velocity at the face quadrature points is non-zero
+ * and whether any of the dislocation densities rho is non-zero on either side of the face.
+ * It is built once per nonlinear iteration and used by the DG advection kernels
+ * to skip the internal faces on which dislocations cannot move
+ * or on which there are no dislocations, without checking the face values again.
+ * Faces that are not found are considered active.
+ */
+class DislocationActivityMap : public InternalSideUserObject
+{
+public:
+  static InputParameters validParams();
+
+  DislocationActivityMap(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject & y) override;
+  virtual void finalize() override{};
+
+  /// True if the dislocation velocity on slip system slip_sys_index is non-zero on side of elem
+  bool isVelocityActive(const Elem * elem,
+                        const unsigned int side,
+                        const unsigned int slip_sys_index) const;
+
+  /// True if any of the dislocation densities is non-zero on side of elem, on either side
+  bool isDensityActive(const Elem * elem, const unsigned int side) const;
+
+  /// True if var_name is one of the dislocation densities checked on the faces
+  bool hasDensity(const VariableName & var_name) const;
+
+protected:
+  /// Dislocation velocity value (signed) on all slip systems at the face
+  const MaterialProperty<std::vector<Real>> & _dislo_velocity;
+
+  /// Dislocation densities whose vanishing makes the DG fluxes vanish
+  const std::vector<VariableName> _rho_names;
+  const std::vector<const VariableValue *> _rho;
+  std::vector<const VariableValue *> _rho_neighbor;
+
+  /// Velocity below this tolerance is considered zero
+  const Real _velocity_tol;
+
+  /// Dislocation density below this tolerance is considered zero
+  const Real _rho_tol;
+
+  /// Activity of a single face
+  struct FaceActivity
+  {
+    /// Slip systems with non-zero dislocation velocity, empty if the face was not visited
+    std::vector<bool> velocity;
+    /// Dislocations are present on at least one side of the face
+    bool density = true;
+  };
+
+  /// Activity of the internal faces of local elements, by element ID and side
+  std::unordered_map<dof_id_type, std::vector<FaceActivity>> _activity;
+
+  /// Face activity of side of elem, nullptr if the face was not visited
+  const FaceActivity * faceActivity(const Elem * elem, const unsigned int side) const;
+};
@@ -0,0 +1,58 @@
+// Nicolò Grilli
+// Università di Bristol
+// 18 Ottobre 2026
+
+#pragma once
+
+#include "ElementUserObject.h"
+
+/**
+ * Positivity-preserving scaling limiter for discontinuous (MONOMIAL)
+ * dislocation densities transported by DGAdvectionRhoGND and DGAdvectionRhoTot.
+ * In each element the high order part of rho_tot, rho_edge and rho_screw
+ * is scaled towards the cell average by a common factor theta in [0,1]
+ * such that rho_tot >= sqrt(rho_edge^2 + rho_screw^2) at all quadrature points
+ * and vertices, which is equivalent to non-negative rho_gnd_pos and rho_gnd_neg
+ * as defined in DGAdvectionRhoGND. Cell averages are conserved, except when
+ * the cell average itself is not admissible: in that case GND averages are
+ * scaled down to |rho_gnd| = rho_tot.
+ */
+class DislocationPositivityLimiter : public ElementUserObject
+{
+public:
+  static InputParameters validParams();
+
+  DislocationPositivityLimiter(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject & y) override;
+  virtual void finalize() override;
+
+protected:
+  /// Check rho_tot >= 0 and positivity of rho_gnd_pos/neg for both characters
+  bool isAdmissible(const Real rho_tot, const Real rho_edge, const Real rho_screw) const;
+
+  /// Largest theta in [0,1] such that avg + theta * delta is admissible
+  Real admissibleTheta(const std::vector<Real> & avg, const std::vector<Real> & delta) const;
+
+  /// Total dislocation density
+  MooseVariable * _rho_tot_var;
+
+  /// Edge and screw GND densities, optional
+  const bool _rho_edge_coupled;
+  const bool _rho_screw_coupled;
+
+  /// All limited variables: rho_tot, then rho_edge and rho_screw if coupled
+  std::vector<MooseVariable *> _vars;
+
+  /// Position of rho_edge and rho_screw in _vars, invalid_uint if not coupled
+  const unsigned int _edge_index;
+  const unsigned int _screw_index;
+
+  /// Number of bisection iterations to find theta
+  const unsigned int _max_its;
+
+  /// Limited dof values to be written into the solution in finalize
+  std::vector<std::pair<dof_id_type, Real>> _limited_dofs;
+};
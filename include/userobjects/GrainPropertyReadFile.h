@@ -5,15 +5,35 @@
 #pragma once
 
 #include "GeneralUserObject.h"
+#include "ElementBinaryDataFile.h"
+#include "NeperTessellation.h"
+#include "EBSDMap.h"
+
+#include "libmesh/elem.h"
+
+#include <unordered_map>
 
 /**
  * Read properties from file - grain or element
  * Input file syntax: prop1 prop2 etc. See test.
  * For grain level, voronoi tesellation with random grain centers are generated;
- * Element center points used for assigning properties
+ * Element center points used for assigning properties:
+ * grain centers are binned on a uniform grid, wrapped in the periodic case,
+ * and the grain of each element is found once
  * Usable for generated mesh
  * using read_type = indexgrain
  * it is possible to read grains as physical volumes assigned in GMSH
+ * using read_type = tessellation
+ * grains are the cells of a Neper .tess file containing the element centroids,
+ * on any mesh
+ * using read_type = ebsd
+ * grains are segmented from an EBSD map (.ang or .ctf) and their Euler angles
+ * are the properties, the grain of each element is the one of the pixel
+ * nearest to its centroid
+ * Binary files (see ElementBinaryDataFile) are detected automatically:
+ * for read_type = element only the elements owned or ghosted by this rank are read
+ * The row of properties of each local element and of its neighbors is resolved
+ * at setup and after every mesh change, including element activation
  */
 
 class GrainPropertyReadFile : public GeneralUserObject
@@ -28,11 +48,24 @@ public:
   virtual void execute() {}
   virtual void finalize() {}
 
+  virtual void meshChanged() override;
+
   /**
    * This function  reads element data from file
    */
   void readElementData();
 
+  /**
+   * This function reads rows of data from binary file
+   * and stores them as _data[row * _nprop + prop]
+   */
+  void readBinaryData(ElementBinaryDataFile & binary_file);
+
+  /**
+   * This function segments the EBSD map and stores the grain Euler angles
+   */
+  void readEBSDData();
+
   /**
    * This function Read grain data from file
    */
@@ -49,6 +82,20 @@ public:
    */
   Real getData(const Elem *, unsigned int) const;
 
+  /**
+   * This function returns the nprop properties of an element,
+   * resolved at setup for the local elements and their neighbors
+   */
+  const Real * elementData(const Elem * elem) const
+  {
+    const auto it = _elem_data.find(elem->id());
+
+    if (it != _elem_data.end())
+      return it->second;
+
+    return &_data[dataRow(elem) * _nprop];
+  }
+
   /**
    * This function assign properties to element read from file with element based properties
    */
@@ -72,6 +119,23 @@ public:
    */
   Real minPeriodicDistance(Point, Point) const;
 
+  /**
+   * This function finds the grain with the nearest center,
+   * the grain with the lowest index if two centers are equally distant
+   */
+  unsigned int nearestGrain(const Point & p) const;
+
+  /**
+   * This function finds the grain with the nearest center
+   * checking all the grain centers, used with grain_search = brute_force
+   */
+  unsigned int bruteForceNearestGrain(const Point & p) const;
+
+  /**
+   * This function finds the row of _data with the properties of an element
+   */
+  unsigned int dataRow(const Elem * elem) const;
+
 protected:
   ///Name of file containing property values
   std::string _prop_file_name;
@@ -81,16 +145,53 @@ protected:
   unsigned int _nprop;
   ///Number of grains (for property read based on grains)
   unsigned int _ngrain;
-  ///Type of read - element or grain or indexgrain
+  ///Type of read - element or grain or indexgrain or tessellation or ebsd
   MooseEnum _read_type;
   ///Random seed - used for generating grain centers
   unsigned int _rand_seed;
   ///Type of grain structure - non-periodic default
   MooseEnum _rve_type;
+  ///Search of the nearest grain center - bins default
+  MooseEnum _grain_search;
 
   MooseMesh & _mesh;
   std::vector<Point> _center;
 
+  /**
+   * This function bins the grain centers on a uniform grid
+   * with about one grain per bin
+   */
+  void initGrainBins();
+
+  /// Bin index of a coordinate along one direction, clamped to the grid
+  int binIndex(const Real x, const unsigned int dim) const;
+
+  /// Number of bins and bin size along each direction
+  unsigned int _nbin[LIBMESH_DIM];
+  Real _bin_size[LIBMESH_DIM];
+
+  /// Grains in each bin: _bin_grains[_bin_offsets[b]] to _bin_grains[_bin_offsets[b+1]]
+  std::vector<unsigned int> _bin_offsets;
+  std::vector<unsigned int> _bin_grains;
+
+  /**
+   * This function resolves the properties of the local elements and their neighbors
+   */
+  void initElementData();
+
+  /// Properties in _data of the elements resolved on this rank, by element id:
+  /// only the local elements and their neighbors are stored
+  std::unordered_map<dof_id_type, const Real *> _elem_data;
+
+  /// Binary element property file, nullptr for text files or grain data
+  std::unique_ptr<ElementBinaryDataFile> _binary_file;
+
+  /// Neper tessellation, nullptr unless read_type = tessellation
+  std::unique_ptr<NeperTessellation> _tessellation;
+
+  /// EBSD map, nullptr unless read_type = ebsd
+  std::unique_ptr<EBSDMap> _ebsd;
+
 private:
   unsigned int _nelem;
   Point _top_right;
@@ -5,10 +5,26 @@
 #pragma once
 
 #include "GeneralUserObject.h"
+#include "ElementBinaryDataFile.h"
+
+#include <fstream>
+#include <future>
+#include <map>
 
 /**
  * Read temperature field from file
  * Usable for generated mesh
+ * In streaming mode, only the window of temperature steps needed
+ * between the old and the current time (step-1, step, step+1) is kept in memory
+ * and the next temperature step is read asynchronously on a background thread
+ * Binary files (see ElementBinaryDataFile) are detected automatically:
+ * only the elements owned or ghosted by this rank are read
+ * With adaptivity, elements created by refinement take the temperature
+ * of their level 0 ancestor, which is the element in the temperature file
+ * If temperature_time_step is set, the temperature of each element at the previous,
+ * current and next temperature step is read serially at the beginning of each
+ * temperature time step, and shared by LaserTempReadFileAux, the TempActDeactElems
+ * auxiliary kernels and ComputeElasticityTensorMelting
  */
 
 class LaserTempReadFile : public GeneralUserObject
@@ -17,12 +33,16 @@ public:
   static InputParameters validParams();
 
   LaserTempReadFile(const InputParameters & parameters);
-  virtual ~LaserTempReadFile() {}
+  virtual ~LaserTempReadFile();
 
   virtual void initialize() {}
   virtual void execute() {}
   virtual void finalize() {}
 
+  virtual void initialSetup() override;
+  virtual void timestepSetup() override;
+  virtual void meshChanged() override;
+
   /**
    * This function reads element data from file
    */
@@ -31,10 +51,62 @@ public:
   /**
    * This function assign temperature data to elements
    */
-  Real getData(const Elem *, unsigned int) const;
+  virtual Real getData(const Elem *, unsigned int) const;
+
+  /// Temperature data of this element are available on this rank
+  virtual bool hasData(const Elem * elem) const;
+
+  /// Number of temperature data field in time
+  unsigned int numSteps() const { return _temperature_num_step; }
+
+  /// Time interval between two temperature data field
+  Real temperatureTimeStep() const;
+
+  /**
+   * Time interval between two temperature data field used by a consumer object:
+   * if it is not set in this user object, the deprecated temperature_time_step
+   * of the consumer is used for all consumers, otherwise it must be equal to it
+   */
+  Real temperatureTimeStep(const MooseObject & consumer) const;
+
+  /// Only the temperature steps needed by the current time step are in memory
+  bool streaming() const { return _streaming; }
+
+  /// Temperature of an element at the previous, current and next temperature step
+  struct Samples
+  {
+    Real previous;
+    Real current;
+    Real next;
+    unsigned int step;
+  };
+
+  /// Samples of this element at the current temperature step,
+  /// previous is equal to current at the first temperature step
+  const Samples & samples(const Elem * elem) const;
+
+  /// Current temperature step
+  unsigned int step() const { return _step; }
+
+  /// Fraction of the current temperature time step from 0 to 1
+  Real fraction() const { return _fraction; }
 
 protected:
-  
+  /**
+   * Constructor for derived classes that store other data than one value per element:
+   * they set _n_data_elem and call openTemperatureFile themselves
+   */
+  LaserTempReadFile(const InputParameters & parameters, const bool read_temperature_file);
+
+  /**
+   * Read the temperature file, or open it in streaming mode:
+   * each temperature step contains _n_data_elem values
+   */
+  void openTemperatureFile();
+
+  /// Stored values of a temperature step, _n_data_elem values
+  const Real * stepData(const unsigned int temperature_step) const;
+
   /// Name of file containing temperature values
   std::string _temperature_file_name;
   
@@ -46,8 +118,80 @@ protected:
   /// Store temperature values read from file
   std::vector<Real> _data;
 
-private:
+  /// Binary temperature file, nullptr for text files
+  std::unique_ptr<ElementBinaryDataFile> _binary_file;
+
+  /// Number of values stored for each temperature step,
+  /// the number of elements for element data
+  unsigned int _n_data_elem;
+
+  /// Position of the element in the stored temperature steps
+  unsigned int dataIndex(const Elem * elem) const;
+
+  /// Keep only the temperature steps needed by the current time step
+  const bool _streaming;
+
+  /// Time interval between two temperature data field,
+  /// it can be set by the deprecated parameter of the first consumer
+  mutable Real _temperature_time_step;
+
+  /// The time interval is set
+  mutable bool _has_temperature_time_step;
+
+  /**
+   * Streaming mode: read the window of temperature steps needed
+   * between the old and the current time and prefetch the next one
+   */
+  void updateWindow();
+
+  /// Binary files: read the rows of these elements after a mesh change
+  void readSelectedElements(const std::vector<dof_id_type> & elem_ids);
+
+  /**
+   * Streaming mode: read one temperature step from the file stream
+   * returns false in case of premature end of file
+   */
+  bool readStep(const unsigned int temperature_step, std::vector<Real> & step_data);
+
+  /**
+   * Temperature step at time t: if the temperature step goes above the maximum
+   * that is readable from file, the temperature is kept constant
+   * as the last temperature step read from file
+   */
+  unsigned int temperatureStep(const Real t) const;
+
+  /**
+   * Update step and fraction at the current time and, if the temperature step
+   * or the mesh changed, read the samples of all the elements with data on this rank.
+   * This is done serially, before the consumers are evaluated on threads
+   */
+  void updateSamples(const bool mesh_changed);
+
+  /// Samples indexed by element id
+  std::vector<Samples> _samples;
+
+  /// Temperature step and fraction of the current time step
+  unsigned int _step;
+  Real _fraction;
+
+  /// Streaming mode: temperature file stream
+  std::ifstream _stream;
+
+  /// Streaming mode: next temperature step that will be read from _stream
+  unsigned int _stream_step;
+
+  /// Streaming mode: temperature values of the steps in the window
+  std::map<unsigned int, std::vector<Real>> _window;
+
+  /// Streaming mode: asynchronous read of the next temperature step
+  std::future<bool> _prefetch;
+  unsigned int _prefetch_step;
+  std::vector<Real> _prefetch_data;
+
+  /// Number of elements in the mesh
   unsigned int _nelem;
+
+private:
   Point _top_right;
   Point _bottom_left;
   Point _range;
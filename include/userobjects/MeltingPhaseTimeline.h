@@ -0,0 +1,102 @@
+// Nicolò Grilli
+// Università di Bristol
+// 18 Ottobre 2026
+
+#pragma once
+
+#include "GeneralUserObject.h"
+#include "LaserTempReadFile.h"
+
+/**
+ * Phase of an element at a temperature time step.
+ * The temperature is limited in the interval gas to liquidus,
+ * consistently with LaserTempReadFileAux and ComputeElasticityTensorMelting,
+ * therefore elements above the solidus are in the mushy zone.
+ */
+enum class MeltingPhase : unsigned char
+{
+  GAS,
+  SOLID,
+  MUSHY
+};
+
+/**
+ * Preprocess the temperature history read by LaserTempReadFile once
+ * into a run-length encoded timeline of the phase of each element:
+ * each run stores the first temperature step and the phase.
+ * Most elements never melt and have a single run.
+ * The number of temperature steps is the one of the LaserTempReadFile.
+ * With adaptivity, elements use the timeline of their level 0 ancestor.
+ * Must be listed after the LaserTempReadFile in the input file.
+ */
+class MeltingPhaseTimeline : public GeneralUserObject
+{
+public:
+  static InputParameters validParams();
+
+  MeltingPhaseTimeline(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override {}
+  virtual void finalize() override {}
+
+  /// Phase of the element at this temperature step
+  MeltingPhase phase(const Elem * elem, const unsigned int temperature_step) const;
+
+  /// The element is solid at this temperature step
+  bool isSolid(const Elem * elem, const unsigned int temperature_step) const
+  {
+    return phase(elem, temperature_step) == MeltingPhase::SOLID;
+  }
+
+  /// First temperature step after this one with a different phase,
+  /// number of temperature steps if the phase does not change anymore
+  unsigned int nextTransition(const Elem * elem, const unsigned int temperature_step) const;
+
+  /// First temperature step at which the element is solid,
+  /// number of temperature steps if it never is or has no timeline on this rank
+  unsigned int firstSolidStep(const Elem * elem) const;
+
+  /// Number of temperature data field in time
+  unsigned int numSteps() const { return _temperature_num_step; }
+
+  /// Time interval between two temperature data field, from the LaserTempReadFile
+  Real temperatureTimeStep() const { return _temperature_read_user_object.temperatureTimeStep(); }
+
+  /// Phase of a temperature value
+  MeltingPhase classify(const Real temperature) const;
+
+  /**
+   * Melting or gas temperature param used by a consumer object:
+   * the value of the timeline is used, a different value
+   * set by the user in the consumer is an error
+   */
+  Real temperatureThreshold(const MooseObject & consumer, const std::string & param) const;
+
+protected:
+  /// Build the runs of all elements on this rank
+  void buildTimeline();
+
+  /// Run of the element containing this temperature step
+  unsigned int findRun(const Elem * elem, const unsigned int temperature_step) const;
+
+  /// The LaserTempReadFile GeneralUserObject to read element specific temperature values from file
+  const LaserTempReadFile & _temperature_read_user_object;
+
+  /// Number of temperature data field in time, from the LaserTempReadFile
+  const unsigned int _temperature_num_step;
+
+  const Real _melting_temperature_high;
+  const Real _melting_temperature_low;
+  const Real _gas_temperature_high;
+  const Real _gas_temperature_low;
+
+  MooseMesh & _mesh;
+
+  /// Runs of level 0 element e are in positions _run_offsets[e] to _run_offsets[e+1]-1
+  std::vector<unsigned int> _run_offsets;
+
+  /// First temperature step and phase of each run
+  std::vector<unsigned int> _run_start;
+  std::vector<MeltingPhase> _run_phase;
+};
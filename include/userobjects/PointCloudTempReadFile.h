@@ -0,0 +1,68 @@
+// Nicolò Grilli
+// Università di Bristol
+// 18 Ottobre 2026
+
+#pragma once
+
+#include "LaserTempReadFile.h"
+
+/**
+ * Read temperature field from a CFD point cloud or structured grid
+ * that does not match the mesh and map it on the element centroids.
+ * Interpolation weights are computed once using a kd-tree (point cloud)
+ * or the grid lines (structured grid). Only the temperature of the CFD points
+ * is stored, it is mapped on an element on demand with its sparse weights.
+ * In streaming mode only the CFD temperature steps needed are kept in memory.
+ * Point file syntax: x y z of each CFD point
+ * Temperature file syntax: temperature of all CFD points for the first time step,
+ * then for the second time step, in the same order as the point file
+ * Can be used by all objects that read LaserTempReadFile
+ */
+class PointCloudTempReadFile : public LaserTempReadFile
+{
+public:
+  static InputParameters validParams();
+
+  PointCloudTempReadFile(const InputParameters & parameters);
+
+  /// Temperature of the element mapped from the CFD points
+  virtual Real getData(const Elem * elem, unsigned int temperature_step) const override;
+
+  /// The element has interpolation weights on this rank
+  virtual bool hasData(const Elem * elem) const override;
+
+protected:
+  /// Read coordinates of the CFD points
+  void readPoints();
+
+  /// Inverse distance weights of the nearest CFD points
+  void computePointCloudWeights();
+
+  /// Trilinear interpolation weights on a structured grid
+  void computeStructuredWeights();
+
+  /// Add an interpolation weight for the current element
+  void addWeight(const unsigned int point, const Real weight);
+
+  /// Name of file containing the coordinates of the CFD points
+  const std::string _point_file_name;
+
+  /// Type of CFD grid: point cloud or structured
+  const MooseEnum _grid_type;
+
+  /// Number of nearest CFD points used by inverse distance weighting
+  const unsigned int _num_neighbors;
+
+  /// Coordinates of the CFD points
+  std::vector<Point> _points;
+
+  /// Diagonal of the bounding box of the CFD points
+  Real _point_range;
+
+  /// Interpolation weights of each element in compressed row storage:
+  /// weights of element e are in positions _weight_offsets[e] to _weight_offsets[e+1]-1,
+  /// elements created by adaptivity use the weights of their level 0 ancestor
+  std::vector<unsigned int> _weight_offsets;
+  std::vector<unsigned int> _weight_points;
+  std::vector<Real> _weight_values;
+};
@@ -0,0 +1,95 @@
+// Nicolò Grilli
+// Università di Bristol
+// 18 Ottobre 2026
+
+#pragma once
+
+#include "GeneralUserObject.h"
+
+/**
+ * Global state of a scan strategy made of straight tracks
+ * travelled at constant velocity. Each track starts at its initial
+ * coordinates and is switched off after its scan length.
+ * When the track is over and the temperature provided by the postprocessor
+ * decreases below the threshold, the next track starts.
+ * The track index and the scan start time are advanced once per time step
+ * and queried by heat source and material deposition objects.
+ * Tracks can be given as input vectors or read from a scan file
+ * with one track per row: x y z scan_length
+ */
+class ScanStrategy : public GeneralUserObject
+{
+public:
+  static InputParameters validParams();
+
+  ScanStrategy(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override {}
+
+  /**
+   * Centre of the source at time t
+   * returns false if the source is switched off
+   */
+  bool sourcePosition(const Real t, Point & center) const;
+
+  /// Index of the current track, equal to the number of tracks when the scan is completed
+  unsigned int track() const { return _n_track; }
+
+  /// Time at which the current track started
+  Real scanStartTime() const { return _t_scan; }
+
+  /// Number of tracks
+  unsigned int numTracks() const { return _init_coords.size(); }
+
+  /**
+   * Parameters of the heat source and material deposition objects
+   * that moved to ScanStrategy: they are kept only to report
+   * where they should be set
+   */
+  static void addMovedParams(InputParameters & params);
+
+  /**
+   * Name of the ScanStrategy given by the scan_strategy parameter of the consumer,
+   * error if one of the moved parameters is set in the consumer
+   */
+  static UserObjectName scanStrategyName(const MooseObject & consumer);
+
+protected:
+  /// Read tracks from the scan file
+  void readScanFile();
+
+  /// Distance travelled along the current track at time t
+  Real scanDistance(const Real t) const;
+
+  /// Scanning speed vector
+  const RealVectorValue _velocity;
+
+  /// Initial coordinates and scan length of each track
+  std::vector<Point> _init_coords;
+  std::vector<Real> _scan_length;
+
+  /// Postprocessor with temperature value
+  /// it provides the condition based on which the source
+  /// is moved to the next track
+  const PostprocessorValue & _temperature_pp;
+
+  /// When the temperature provided by the postprocessor decreases
+  /// below this threshold, the source is moved to the next track
+  const Real _threshold_temperature;
+
+  /// Current track index
+  unsigned int & _n_track;
+
+  /// Simulation time at which the current track started
+  Real & _t_scan;
+
+  /// Track index and scan start time at the beginning of the time step
+  /// restored when a time step is cut and repeated
+  unsigned int & _n_track_old;
+  Real & _t_scan_old;
+
+  /// Time step in which the state was last advanced
+  int & _t_step_old;
+};
@@ -0,0 +1,37 @@
+// Nicolò Grilli
+// Università di Bristol
+// 18 Ottobre 2026
+
+#pragma once
+
+#include "GeneralUserObject.h"
+#include "StructuredGridData.h"
+
+/**
+ * Values on the points of a 2D or 3D structured grid read from file once
+ * and shared by all the ReadFileIC initial conditions, one column for each variable.
+ * Each rank stores only the grid points around the elements it owns or ghosts.
+ * See StructuredGridData for the file format and the interpolation.
+ */
+class StructuredGridReadFile : public GeneralUserObject
+{
+public:
+  static InputParameters validParams();
+
+  StructuredGridReadFile(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override {}
+  virtual void finalize() override {}
+
+  /// Values on the grid
+  const StructuredGridData & gridData() const { return *_grid_data; }
+
+protected:
+  /// Bounding box of the nodes of the elements owned or ghosted by this rank
+  libMesh::BoundingBox localBoundingBox() const;
+
+  MooseMesh & _mesh;
+
+  std::unique_ptr<StructuredGridData> _grid_data;
+};
@@ -0,0 +1,59 @@
+// Nicolò Grilli
+// Università di Bristol
+// 18 Ottobre 2026
+
+#pragma once
+
+#include "GeneralUserObject.h"
+
+/**
+ * Toolpath of the heat source read from a CSV file
+ * with one waypoint per row: t x y z power
+ * or from a G-code file with G0 (laser off) and G1 (laser on) moves.
+ * The G-code subset is G0, G1, G4, G90, G91, M3, M4, M5, S and F:
+ * G21, G28, G92, E and T words and the M104, M109, M140 and M190
+ * temperature blocks of 3D printer files are ignored, other words are errors.
+ * The position is linearly interpolated between waypoints,
+ * the power of each segment is the power of its first waypoint,
+ * so the laser can be switched on and off.
+ * Waypoint times are precomputed once and the segment
+ * containing a given time is found by binary search.
+ */
+class Toolpath : public GeneralUserObject
+{
+public:
+  static InputParameters validParams();
+
+  Toolpath(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override {}
+  virtual void finalize() override {}
+
+  /// Position and power of the heat source at time t
+  void sourceState(const Real t, Point & center, Real & power) const;
+
+  /// Number of waypoints
+  unsigned int numWaypoints() const { return _times.size(); }
+
+  /// Time, position and power of each waypoint:
+  /// the power applies to the segment starting at the waypoint
+  const std::vector<Real> & times() const { return _times; }
+  const std::vector<Point> & points() const { return _points; }
+  const std::vector<Real> & powers() const { return _powers; }
+
+protected:
+  /// Read waypoints from CSV file
+  void readCSV(const std::string & file_name);
+
+  /// Read waypoints from G-code file
+  void readGCode(const std::string & file_name);
+
+  /// Add a waypoint
+  void addWaypoint(const Real t, const Point & p, const Real power);
+
+  /// Time, position and power of each waypoint
+  std::vector<Real> _times;
+  std::vector<Point> _points;
+  std::vector<Real> _powers;
+};
@@ -0,0 +1,123 @@
+// Nicolò Grilli
+// Università di Bristol
+// 18 Ottobre 2026
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include "libmesh/point.h"
+
+#include <array>
+
+/**
+ * EBSD map read from a TSL .ang file or an Oxford HKL .ctf file
+ * on a square grid, 2D or 3D (.ctf with a Z column).
+ * Grains are segmented by merging neighboring indexed pixels
+ * with misorientation below a threshold, considering crystal symmetry,
+ * with a concurrent union-find. Non-indexed pixels are assigned
+ * to the grain of the nearest indexed pixel on the grid.
+ * The orientation of each grain is the mean of the pixel orientations
+ * reduced to the fundamental zone of the grain reference pixel,
+ * returned as Bunge Euler angles in degrees, as in the Euler angles files
+ * read by GrainPropertyReadFile.
+ * Grains are numbered in the order of their first pixel on the grid,
+ * x fastest, then y, then z.
+ */
+class EBSDMap
+{
+public:
+  /// Crystal symmetry used to compute the misorientation
+  enum class Symmetry
+  {
+    CUBIC,
+    HEXAGONAL,
+    NONE
+  };
+
+  EBSDMap(const std::string & file_name,
+          const Real misorientation_threshold,
+          const Symmetry symmetry,
+          const Real min_confidence_index);
+
+  /// Number of grains
+  unsigned int nGrains() const { return _grain_euler.size(); }
+
+  /// Bunge Euler angles in degrees of a grain
+  const RealVectorValue & grainEulerAngles(const unsigned int grain) const
+  {
+    return _grain_euler[grain];
+  }
+
+  /// Grain of the pixel nearest to the point
+  unsigned int grain(const Point & p) const;
+
+  /// Write the grain index and the Euler angles of the grains in CSV format, one grain per row
+  void writeGrainTable(const std::string & file_name) const;
+
+  /// Write the Euler angles of the grains separated by spaces, one grain per row,
+  /// in the format of the property files of GrainPropertyReadFile
+  void writeEulerAngles(const std::string & file_name) const;
+
+protected:
+  typedef std::array<Real, 4> Quaternion;
+
+  /// Read the pixels of an .ang file, Euler angles in radians
+  void readAng();
+
+  /// Read the pixels of a .ctf file, Euler angles in degrees
+  void readCtf();
+
+  /// Store a pixel at position x, y, z with Bunge Euler angles in radians
+  void addPixel(const Real x, const Real y, const Real z,
+                const Real phi1, const Real Phi, const Real phi2, const bool indexed);
+
+  /// Place the pixels on the grid
+  void buildGrid();
+
+  /// Grid index along one direction of a coordinate, clamped to the grid
+  unsigned int gridIndex(const Real x, const unsigned int dim) const;
+
+  /// Merge neighboring pixels with small misorientation and number the grains
+  void segment();
+
+  /// Assign non-indexed pixels to the nearest grain
+  void fillNonIndexed();
+
+  /// Mean orientation of each grain
+  void averageOrientations();
+
+  /// Misorientation angle in radians between two orientations
+  Real misorientation(const Quaternion & a, const Quaternion & b) const;
+
+  static Quaternion eulerToQuaternion(const Real phi1, const Real Phi, const Real phi2);
+  static RealVectorValue quaternionToEuler(const Quaternion & q);
+  static Quaternion multiply(const Quaternion & a, const Quaternion & b);
+
+  const std::string _file_name;
+  const Real _misorientation_threshold;
+  const Real _min_confidence_index;
+
+  /// Symmetry operations of the crystal
+  std::vector<Quaternion> _symmetry;
+
+  /// Step and number of grid points along x, y, z and position of the first grid point
+  Real _step[3];
+  unsigned int _n[3];
+  Real _origin[3];
+
+  /// Pixels in file order, released once on the grid
+  std::vector<std::array<float, 3>> _pixel_position;
+  std::vector<std::array<float, 4>> _pixel_orientation;
+  std::vector<char> _pixel_indexed;
+
+  /// Orientation of each grid point and indexed flag, missing points are not indexed
+  std::vector<std::array<float, 4>> _orientation;
+  std::vector<char> _indexed;
+
+  /// Grain of each grid point
+  std::vector<unsigned int> _grid_grain;
+
+  /// Mean Bunge Euler angles in degrees of each grain
+  std::vector<RealVectorValue> _grain_euler;
+};
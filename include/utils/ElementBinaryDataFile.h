@@ -0,0 +1,120 @@
+// Nicolò Grilli
+// Università di Bristol
+// 18 Ottobre 2026
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <unordered_map>
+
+class MooseMesh;
+
+/**
+ * Binary columnar file with one row of values for each element
+ * (or grain) and one column for each temperature step (or property).
+ * Layout of the file, little endian:
+ * header of 64 bytes:
+ *   char[8]  magic "CPFORBIN"
+ *   uint32   version
+ *   uint32   layout: 0 = element-major (the columns of one row are contiguous)
+ *                    1 = step-major (the rows of one column are contiguous)
+ *   uint64   number of rows
+ *   uint64   number of columns
+ *   uint32   1 if an element ID permutation follows the header
+ *   padding up to 64 bytes
+ * optional permutation: uint64 element ID of each row of the file
+ * data: double values
+ * Only the rows of the selected elements are read with pread:
+ * selected rows close to each other are read together in blocks
+ * of limited size, also when only some columns are requested,
+ * and the requested values are extracted in memory. Reads are thread safe.
+ * Text files can be converted with scripts/text_to_binary.py
+ * With adaptivity, the elements created by refinement
+ * use the row of their level 0 ancestor, see localRowIds
+ */
+class ElementBinaryDataFile
+{
+public:
+  ElementBinaryDataFile(const std::string & file_name);
+  ~ElementBinaryDataFile();
+
+  /// Check if the file starts with the binary header
+  static bool isBinary(const std::string & file_name);
+
+  /// IDs of the elements owned or ghosted by this rank and their face neighbors
+  static std::vector<dof_id_type> localElementIds(const MooseMesh & mesh);
+
+  /// IDs of the level 0 ancestors of localElementIds, that are the rows needed by this rank
+  static std::vector<dof_id_type> localRowIds(const MooseMesh & mesh);
+
+  /// Number of rows and columns in the file
+  dof_id_type nRows() const { return _n_rows; }
+  unsigned int nColumns() const { return _n_cols; }
+
+  /**
+   * Select the elements that will be read
+   * and find their rows in the file
+   */
+  void selectElements(const std::vector<dof_id_type> & elem_ids);
+
+  /// Position of this element in the data returned by read, invalid_uint if not selected
+  unsigned int index(const dof_id_type elem_id) const;
+
+  /// Number of selected elements and their IDs
+  unsigned int nSelected() const { return _elem_ids.size(); }
+  const std::vector<dof_id_type> & selectedElements() const { return _elem_ids; }
+
+  /**
+   * Read columns first_col to first_col + n_col - 1 of the selected elements
+   * data[c * nSelected() + index] is the value of column first_col + c
+   */
+  void read(const unsigned int first_col,
+            const unsigned int n_col,
+            std::vector<Real> & data) const;
+
+  /**
+   * Same as read, but returns false instead of raising an error
+   * in case of premature end of file, for reads on background threads
+   */
+  bool tryRead(const unsigned int first_col,
+               const unsigned int n_col,
+               std::vector<Real> & data) const;
+
+protected:
+  /// Read size bytes at offset, error in case of premature end of file
+  void readBytes(void * buffer, const std::size_t size, const std::size_t offset) const;
+
+  /// Read size bytes at offset, false in case of premature end of file
+  bool tryReadBytes(void * buffer, const std::size_t size, const std::size_t offset) const;
+
+  /// Offset in bytes of a value in the file
+  std::size_t offset(const dof_id_type row, const unsigned int col) const;
+
+  const std::string _file_name;
+
+  /// File descriptor
+  int _fd;
+
+  /// Element-major or step-major layout
+  bool _element_major;
+
+  dof_id_type _n_rows;
+  unsigned int _n_cols;
+
+  /// An element ID permutation is stored after the header
+  bool _has_permutation;
+
+  /// Offset in bytes of the data block
+  std::size_t _data_offset;
+
+  /// Selected elements and their rows in the file
+  std::vector<dof_id_type> _elem_ids;
+  std::vector<dof_id_type> _rows;
+
+  /// Position of each selected element in _elem_ids
+  std::unordered_map<dof_id_type, unsigned int> _index;
+
+  /// Selected positions sorted by row, to read close rows together
+  std::vector<unsigned int> _sorted;
+};
@@ -0,0 +1,42 @@
+// Nicolò Grilli
+// Università di Bristol
+// 18 Ottobre 2026
+
+#pragma once
+
+#include "MooseArray.h"
+#include "MooseTypes.h"
+
+#include "libmesh/point.h"
+
+/**
+ * Bounding box of an ellipsoidal Gaussian heat source
+ * exp(-3 x^2 / rx^2 - 3 y^2 / ry^2 - 3 z^2 / rz^2)
+ * outside of which the exponent is larger than the cutoff exponent
+ * and the heat source is numerically zero.
+ * The box is updated once per time step from the heat source centre,
+ * then elements whose quadrature points are all outside the box
+ * can be skipped without evaluating the exponential.
+ */
+class HeatSourceCulling
+{
+public:
+  HeatSourceCulling(const Real cutoff_exponent);
+
+  /// Update the box around the centre of the heat source with radii rx, ry, rz
+  void update(const Point & center, const RealVectorValue & radii);
+
+  /// All quadrature points of the element are outside the box
+  bool isOutside(const MooseArray<Point> & q_points) const;
+
+  /// The exponent is larger than the cutoff exponent
+  bool isCulled(const Real exponent) const { return exponent > _cutoff_exponent; }
+
+protected:
+  /// Exponent above which the heat source is considered zero
+  const Real _cutoff_exponent;
+
+  /// Corners of the bounding box
+  Point _bottom_left;
+  Point _top_right;
+};
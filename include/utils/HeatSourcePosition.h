@@ -0,0 +1,40 @@
+// Nicolò Grilli
+// Università di Bristol
+// 18 Ottobre 2026
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include "libmesh/point.h"
+
+class Function;
+class ScanStrategy;
+class Toolpath;
+
+/**
+ * Position of a moving heat source for objects that follow it
+ * without computing it, such as markers and postprocessors.
+ * The position is given by a ScanStrategy, as in VelocityEllipsoidHeatSource,
+ * by a Toolpath, or by path functions, as in FunctionPathEllipsoidMaterial.
+ */
+class HeatSourcePosition
+{
+public:
+  HeatSourcePosition(const ScanStrategy * scan_strategy,
+                     const Toolpath * toolpath,
+                     const Function & function_x,
+                     const Function & function_y,
+                     const Function & function_z);
+
+  /// Position of the source at time t, false if the source is off
+  bool position(const Real t, Point & center) const;
+
+protected:
+  const ScanStrategy * const _scan_strategy;
+  const Toolpath * const _toolpath;
+
+  const Function & _function_x;
+  const Function & _function_y;
+  const Function & _function_z;
+};
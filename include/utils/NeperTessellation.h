@@ -0,0 +1,86 @@
+// Nicolò Grilli
+// Università di Bristol
+// 18 Ottobre 2026
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include "libmesh/point.h"
+
+/**
+ * Tessellation read from a Neper .tess file (format 3.4).
+ * Each polyhedron is a convex cell stored as the half-spaces of its faces,
+ * oriented with the mean of the cell vertices inside.
+ * The cells are found with a bounding volume hierarchy
+ * built on the bounding boxes of the cells,
+ * so that a point is tested against a few cells only.
+ * Cell index i corresponds to Neper cell id i + 1.
+ */
+class NeperTessellation
+{
+public:
+  NeperTessellation(const std::string & file_name);
+
+  /// Number of cells
+  unsigned int nCells() const { return _plane_offsets.size() - 1; }
+
+  /// Seed of a cell
+  const Point & seed(const unsigned int cell) const { return _seeds[cell]; }
+
+  /**
+   * Cell containing the point,
+   * the cell with the smallest distance outside its faces
+   * if the point is on a face or slightly outside the domain
+   */
+  unsigned int cell(const Point & p) const;
+
+protected:
+  /// Read cells, vertices, faces and polyhedra from the file
+  void read();
+
+  /// Half-spaces of the faces of each cell
+  void buildPlanes(const std::vector<Point> & vertices,
+                   const std::vector<std::vector<unsigned int>> & faces,
+                   const std::vector<std::vector<int>> & polyhedra);
+
+  /// Build the bounding volume hierarchy of the cells in _bvh_cells[begin] to _bvh_cells[end - 1]
+  unsigned int buildNode(const unsigned int begin, const unsigned int end);
+
+  /// Largest distance of the point outside the faces of a cell, negative if inside
+  Real outsideDistance(const unsigned int cell, const Point & p) const;
+
+  const std::string _file_name;
+
+  /// Seeds of the cells
+  std::vector<Point> _seeds;
+
+  /// Faces of cell c: _normals[_plane_offsets[c]] to _normals[_plane_offsets[c + 1] - 1]
+  /// A point p is inside the cell if normal * p <= distance for all faces
+  std::vector<unsigned int> _plane_offsets;
+  std::vector<Point> _normals;
+  std::vector<Real> _distances;
+
+  /// Bounding box of each cell
+  std::vector<Point> _cell_min;
+  std::vector<Point> _cell_max;
+
+  /// Node of the bounding volume hierarchy:
+  /// leaves contain _bvh_cells[begin] to _bvh_cells[end - 1],
+  /// inner nodes have children left and right
+  struct BVHNode
+  {
+    Point min;
+    Point max;
+    unsigned int begin;
+    unsigned int end;
+    unsigned int left;
+    unsigned int right;
+  };
+
+  std::vector<BVHNode> _bvh;
+  std::vector<unsigned int> _bvh_cells;
+
+  /// Tolerance on the distance outside the faces
+  Real _tolerance;
+};
@@ -0,0 +1,74 @@
+// Nicolò Grilli
+// Università di Bristol
+// 18 Ottobre 2026
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include "libmesh/bounding_box.h"
+
+#include <array>
+
+/**
+ * Values on the points of a structured grid read from file,
+ * one row for each grid point with x fastest, then y, then z,
+ * and one column for each variable.
+ * Grid point (i, j, k) is at (i dx, j dy, k dz), 2D grids have nz = 1.
+ * Values at a point are those of the grid cell containing it
+ * or are interpolated trilinearly between the eight surrounding grid points,
+ * points outside the grid take the value of the nearest boundary.
+ * Text files are read with DelimitedFileReader, binary files
+ * (see ElementBinaryDataFile, one row per grid point) are read only
+ * for the grid points in the bounding box given to the constructor.
+ */
+class StructuredGridData
+{
+public:
+  /// Read all grid points if box is nullptr
+  StructuredGridData(const std::string & file_name,
+                     const std::array<unsigned int, 3> & n,
+                     const RealVectorValue & spacing,
+                     const unsigned int ncolumns,
+                     const bool trilinear,
+                     const libMesh::BoundingBox * box = nullptr);
+
+  /// Number of columns, one for each variable
+  unsigned int nColumns() const { return _ncolumns; }
+
+  /// Value of a column at a point
+  Real value(const Point & p, const unsigned int column) const;
+
+  /// Gradient of a column at a point, zero without interpolation
+  RealGradient gradient(const Point & p, const unsigned int column) const;
+
+protected:
+  /// Read the rows of the grid points in the stored range from a text file
+  void readText();
+
+  /// Read the rows of the grid points in the stored range from a binary file
+  void readBinary();
+
+  /// Grid point and weight of the next grid point along one direction
+  void locate(const Point & p, const unsigned int dim, unsigned int & i, Real & w) const;
+
+  /// Value of a column at a grid point, which must be in the stored range
+  Real at(const unsigned int i, const unsigned int j, const unsigned int k,
+          const unsigned int column) const;
+
+  const std::string _file_name;
+
+  /// Number of grid points and grid spacing along x, y, z
+  const std::array<unsigned int, 3> _n;
+  const RealVectorValue _spacing;
+
+  const unsigned int _ncolumns;
+  const bool _trilinear;
+
+  /// Range of grid points stored on this rank, from _lo to _hi included
+  std::array<unsigned int, 3> _lo;
+  std::array<unsigned int, 3> _hi;
+
+  /// _data[point * _ncolumns + column], points of the stored range with x fastest
+  std::vector<Real> _data;
+};
@@ -0,0 +1,86 @@
+// Nicolò Grilli
+// Università di Bristol
+// 18 Ottobre 2026
+
+#pragma once
+
+#include "GeneralVectorPostprocessor.h"
+#include "HeatSourcePosition.h"
+
+#include <unordered_map>
+
+class MooseVariableFieldBase;
+
+/**
+ * Melt pool length, width, depth, volume and peak temperature
+ * computed every time step from the temperature of the elements
+ * in a box around the current position of the heat source.
+ * The local elements are binned on a uniform grid once
+ * and after every mesh change, so that only the bins
+ * overlapping the box are visited.
+ * Length, width and depth are the extents of the molten nodes
+ * along the scan direction, the width direction and the depth direction,
+ * the volume is the volume of the elements whose average temperature
+ * is above the melting temperature.
+ */
+class MeltPoolMetrics : public GeneralVectorPostprocessor
+{
+public:
+  static InputParameters validParams();
+
+  MeltPoolMetrics(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override;
+
+  virtual void meshChanged() override { _bins_built = false; }
+
+protected:
+  /// Bin the local active elements
+  void buildBins();
+
+  /// Key of the bin with these indices
+  std::size_t binKey(const long ix, const long iy, const long iz) const;
+
+  /// Bin index along one direction
+  long binIndex(const Real x) const;
+
+  /// Update melt pool extents and volume with this element
+  void addElement(const Elem * elem, const NumericVector<Number> & solution);
+
+  /// Temperature variable
+  const MooseVariableFieldBase & _temperature_var;
+
+  /// Temperature above which the material is molten
+  const Real _melting_temperature;
+
+  /// Half width of the box around the heat source
+  const Real _search_radius;
+
+  /// Unit vectors along which length, width and depth are measured
+  RealVectorValue _scan_direction;
+  RealVectorValue _width_direction;
+  RealVectorValue _depth_direction;
+
+  /// Position of the heat source
+  const HeatSourcePosition _source_position;
+
+  /// Local active elements in each bin of size search_radius
+  std::unordered_map<std::size_t, std::vector<const Elem *>> _bins;
+  bool _bins_built;
+
+  /// Minimum and maximum coordinates of the molten nodes
+  /// along the scan, width and depth directions
+  RealVectorValue _min_coord;
+  RealVectorValue _max_coord;
+
+  Real _volume;
+  Real _peak_temperature;
+
+  VectorPostprocessorValue & _length;
+  VectorPostprocessorValue & _width;
+  VectorPostprocessorValue & _depth;
+  VectorPostprocessorValue & _melt_volume;
+  VectorPostprocessorValue & _peak;
+};
@@ -0,0 +1,35 @@
+// Nicolò Grilli
+// Università di Bristol
+// 18 Ottobre 2026
+
+#pragma once
+
+#include "GeneralVectorPostprocessor.h"
+#include "Toolpath.h"
+
+/**
+ * Time, position and power of the waypoints of a Toolpath
+ * to check the segments read from a CSV or G-code file.
+ * The power of each waypoint applies to the segment starting at that waypoint.
+ */
+class ToolpathWaypoints : public GeneralVectorPostprocessor
+{
+public:
+  static InputParameters validParams();
+
+  ToolpathWaypoints(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+
+protected:
+  /// Toolpath with the waypoints
+  const Toolpath & _toolpath;
+
+  /// Time, coordinates and power of each waypoint
+  VectorPostprocessorValue & _waypoint_time;
+  VectorPostprocessorValue & _x;
+  VectorPostprocessorValue & _y;
+  VectorPostprocessorValue & _z;
+  VectorPostprocessorValue & _power;
+};
@@ -0,0 +1,102 @@
+#!/usr/bin/env python3
+
+# Nicolò Grilli
+# Università di Bristol
+# 18 Ottobre 2026
+
+# Convert temperature or property text files read by
+# LaserTempReadFile and GrainPropertyReadFile
+# into the binary format read by ElementBinaryDataFile.
+#
+# Temperature files (LaserTempReadFile) store all elements of
+# the first temperature step, then all elements of the second one:
+#   text_to_binary.py temperature.txt temperature.bin --columns 3 --text-layout step
+# Property files (GrainPropertyReadFile) store one row for each element or grain:
+#   text_to_binary.py euler.txt euler.bin --columns 3 --text-layout element
+#
+# --layout chooses the binary layout: element-major is best when all
+# columns are read at once, step-major when one temperature step is read at a time.
+# --permutation gives the element ID of each row of the binary file,
+# for instance elements sorted by partition, so that each rank reads contiguous rows.
+
+import argparse
+import struct
+import sys
+from array import array
+
+MAGIC = b'CPFORBIN'
+VERSION = 1
+HEADER_SIZE = 64
+
+
+def read_values(file_name):
+  values = array('d')
+  with open(file_name) as f:
+    for line in f:
+      values.extend(float(v) for v in line.split())
+  return values
+
+
+def main():
+  parser = argparse.ArgumentParser(description='Convert text element data to binary format.')
+  parser.add_argument('input', help='text file')
+  parser.add_argument('output', help='binary file')
+  parser.add_argument('--columns', type=int, required=True,
+                      help='number of temperature steps or properties')
+  parser.add_argument('--text-layout', choices=['element', 'step'], required=True,
+                      help='element: one row for each element; step: one block for each temperature step')
+  parser.add_argument('--layout', choices=['element', 'step'], default='step',
+                      help='layout of the binary file')
+  parser.add_argument('--permutation',
+                      help='text file with the element ID stored in each row of the binary file')
+  args = parser.parse_args()
+
+  values = read_values(args.input)
+  n_cols = args.columns
+
+  if len(values) % n_cols != 0:
+    sys.exit('Number of values ' + str(len(values)) + ' is not a multiple of ' + str(n_cols))
+
+  n_rows = len(values) // n_cols
+
+  # value of element e in column c
+  if args.text_layout == 'element':
+    value = lambda e, c: values[e * n_cols + c]
+  else:
+    value = lambda e, c: values[c * n_rows + e]
+
+  if args.permutation:
+    with open(args.permutation) as f:
+      permutation = [int(v) for v in f.read().split()]
+    if sorted(permutation) != list(range(n_rows)):
+      sys.exit('Permutation must contain each element ID from 0 to ' + str(n_rows - 1) + ' once')
+  else:
+    permutation = list(range(n_rows))
+
+  data = array('d')
+  if args.layout == 'element':
+    for e in permutation:
+      data.extend(value(e, c) for c in range(n_cols))
+  else:
+    for c in range(n_cols):
+      data.extend(value(e, c) for e in permutation)
+
+  header = struct.pack('<8sIIQQII', MAGIC, VERSION, 0 if args.layout == 'element' else 1,
+                       n_rows, n_cols, 1 if args.permutation else 0, 0)
+  header += b'\0' * (HEADER_SIZE - len(header))
+
+  if sys.byteorder != 'little':
+    data.byteswap()
+
+  with open(args.output, 'wb') as f:
+    f.write(header)
+    if args.permutation:
+      perm = array('Q', permutation)
+      if sys.byteorder != 'little':
+        perm.byteswap()
+      perm.tofile(f)
+    data.tofile(f)
+
+
+if __name__ == '__main__':
+  main()
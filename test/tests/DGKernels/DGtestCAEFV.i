@@ -0,0 +1,156 @@
+# Cell-centered finite volume advection with CAEFVKernel
+# on four cells of size h = 0.25, velocity 1 and dt = 0.125.
+# With constant monomials the face values are the cell values
+# and implicit upwinding gives, with c = dt / h = 0.5,
+# u_i (1 + c) = u_i_old + c u_(i-1) in the first three cells
+# and u_3 = u_3_old + c u_2 in the last one, which has no outflow:
+# step 1: 2/3 2/9 2/27 1/27
+# step 2: 4/9 8/27 4/27 1/9
+# The problem is linear and the Jacobian is exact,
+# so Newton converges in a single iteration.
+
+[Mesh]
+
+  [./gen]
+    type = GeneratedMeshGenerator
+    dim = 1
+    nx = 4
+    xmax = 1.0
+  [../]
+
+[]
+
+[Variables]
+
+  [./u]
+    order = CONSTANT
+    family = MONOMIAL
+    [./InitialCondition]
+      type = FunctionIC
+      function = init_u
+    [../]
+  [../]
+
+[]
+
+[Functions]
+
+  [./init_u]
+    type = ParsedFunction
+	value = 'if(x<0.25,1.0,0.0)'
+  [../]
+
+[]
+
+[UserObjects]
+
+  [./upwind_flux]
+    type = AEFVUpwindInternalSideFlux
+    velocity = 1.0
+  [../]
+
+[]
+
+[Kernels]
+
+  [./du_dt]
+    type = TimeDerivative
+    variable = u
+  [../]
+
+[]
+
+[DGKernels]
+
+  [./u_advection]
+    type = CAEFVKernel
+    variable = u
+    rho_coupled = u
+    flux = upwind_flux
+  [../]
+
+[]
+
+[Materials]
+
+  # Face values of the coupled variable used by the flux
+  [./rho_coupled]
+    type = ParsedMaterial
+    f_name = rho_coupled
+    args = 'u'
+    function = 'u'
+  [../]
+
+[]
+
+[Postprocessors]
+
+  [./u0]
+    type = ElementalVariableValue
+    variable = u
+    elementid = 0
+    execute_on = 'initial timestep_end'
+  [../]
+
+  [./u1]
+    type = ElementalVariableValue
+    variable = u
+    elementid = 1
+    execute_on = 'initial timestep_end'
+  [../]
+
+  [./u2]
+    type = ElementalVariableValue
+    variable = u
+    elementid = 2
+    execute_on = 'initial timestep_end'
+  [../]
+
+  [./u3]
+    type = ElementalVariableValue
+    variable = u
+    elementid = 3
+    execute_on = 'initial timestep_end'
+  [../]
+
+  # No flux through the boundaries
+  [./u_integral]
+    type = ElementIntegralVariablePostprocessor
+    variable = u
+    execute_on = 'initial timestep_end'
+  [../]
+
+[]
+
+[Preconditioning]
+
+  [./smp]
+    type = SMP
+    full = true
+  [../]
+
+[]
+
+[Executioner]
+
+  type = Transient
+  solve_type = 'NEWTON'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+
+  line_search = 'none'
+
+  nl_max_its = 1
+  nl_rel_tol = 1e-10
+  nl_abs_tol = 1e-12
+
+  dt = 0.125
+  num_steps = 2
+
+[]
+
+[Outputs]
+
+  csv = true
+
+[]
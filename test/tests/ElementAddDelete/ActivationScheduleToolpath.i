@@ -0,0 +1,95 @@
+# element birth along a toolpath with an activation schedule
+# the substrate is the first element, x in [0, 1],
+# it is never reached by the toolpath and remains active
+# the deposition head moves from x = 1.5 to x = 3.5 between t = 0 and t = 2
+# and the deposition ellipsoid has radius 0.25,
+# therefore the centroids at x = 1.5, 2.5, 3.5
+# are activated at t = 0, 0.75, 1.75
+
+[Problem]
+  kernel_coverage_check = false
+  solve = false
+[]
+
+[Mesh]
+  [./gen]
+    type = GeneratedMeshGenerator
+    dim = 2
+    xmin = 0.0
+    xmax = 4.0
+    ymin = 0.0
+    ymax = 1.0
+    nx = 4
+    ny = 1
+    elem_type = QUAD4
+  [../]
+  [./substrate]
+    input = gen
+    type = SubdomainBoundingBoxGenerator
+    bottom_left = '0.0 0.0 -1.0'
+    top_right = '1.0 1.0 1.0'
+    block_id = 1
+  [../]
+  [./deposit]
+    input = substrate
+    type = SubdomainBoundingBoxGenerator
+    bottom_left = '1.0 0.0 -1.0'
+    top_right = '4.0 1.0 1.0'
+    block_id = 2
+  [../]
+  [./sidesets]
+    input = deposit
+    type = SideSetsAroundSubdomainGenerator
+    normal = '1 0 0'
+    block = 1
+    new_boundary = 'moving_interface'
+  [../]
+[]
+
+[Variables]
+  [./temp]
+    block = '1'
+  [../]
+[]
+
+[UserObjects]
+  [./toolpath]
+    type = Toolpath
+    toolpath_file = 'toolpath_deposition.csv'
+  [../]
+  [./schedule]
+    type = ActivationSchedule
+    toolpath = toolpath
+    deposition_radii = '0.25 0.25 0.25'
+  [../]
+  [./activated_elem_uo]
+    type = ActDeactElementsMelting
+    execute_on = timestep_begin
+    activation_schedule = schedule
+    active_subdomain_id = 1
+    deactive_subdomain_id = 2
+    expand_boundary_name = 'moving_interface'
+  [../]
+[]
+
+[Postprocessors]
+  [./active_volume]
+    type = VolumePostprocessor
+    block = '1'
+  [../]
+  [./inactive_volume]
+    type = VolumePostprocessor
+    block = '2'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  start_time = 0.0
+  end_time = 3.0
+  dt = 1.0
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,279 @@
+# element activation with a crystal plasticity material
+# on a mesh refined around a moving heat source
+# the temperature is 303 K for x < t + 1 and 503 K elsewhere
+# and elements are activated below 403 K at the beginning of each time step
+# with the temperature of the previous time step:
+# the active volume is t also after refinement and coarsening
+# the heat source is at x = t and refines the elements around it
+
+[Problem]
+  kernel_coverage_check = false
+[]
+
+[Mesh]
+  [./gen]
+    type = GeneratedMeshGenerator
+    dim =  3
+    xmin = 0.0
+    xmax = 4.0
+    ymin = 0.0
+    ymax = 1.0
+    zmin = 0.0
+    zmax = 1.0
+    nx= 4
+    ny= 1
+    nz= 1
+    elem_type = HEX8
+  [../]
+  [./active_domain]
+    input = gen
+    type = SubdomainBoundingBoxGenerator
+    bottom_left = '0.0 0.0 0.0'
+    top_right = '1.0 1.0 1.0'
+    block_id = 1
+  [../]
+  [./deactivated_domain]
+    input = active_domain
+    type = SubdomainBoundingBoxGenerator
+    bottom_left = '1.0 0.0 0.0'
+    top_right = '4.0 1.0 1.0'
+    block_id = 2
+  [../]
+  [./sidesets]
+    input = deactivated_domain
+    type = SideSetsAroundSubdomainGenerator
+    normal = '1 0 0'
+    block = 1
+    new_boundary = 'moving_interface'
+  []
+[]
+
+[GlobalParams]
+  displacements = 'disp_x disp_y disp_z'
+[]
+
+[Variables]
+  [./disp_x]
+    order = FIRST
+    family = LAGRANGE
+    block = '1'
+  [../]
+
+  [./disp_y]
+    order = FIRST
+    family = LAGRANGE
+    block = '1'
+  [../]
+
+  [./disp_z]
+    order = FIRST
+    family = LAGRANGE
+    block = '1'
+  [../]
+[]
+
+[AuxVariables]
+  [./temp]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[Functions]
+  [./temperature_load]
+    type = ParsedFunction
+    value = 'if(x<t+1.0,303.0,503.0)'
+  [../]
+  [./path_x]
+    type = ParsedFunction
+    value = 't'
+  [../]
+  [./path_y]
+    type = ParsedFunction
+    value = '0.5'
+  [../]
+  [./path_z]
+    type = ParsedFunction
+    value = '0.5'
+  [../]
+[]
+
+[UserObjects]
+  [./prop_read]
+    type = GrainPropertyReadFile
+    prop_file_name = 'euler_ang_test.inp'
+    # Enter file data as prop#1, prop#2, .., prop#nprop
+    nprop = 3
+    ngrain = 1
+    read_type = indexgrain
+  [../]
+  [./activated_elem_uo]
+    type = ActDeactElementsCoupled
+    execute_on = timestep_begin
+    coupled_var = temp
+    activate_value = 403.0
+    activate_type = below
+    active_subdomain_id = 1
+    deactive_subdomain_id = 2
+    expand_boundary_name = 'moving_interface'
+  [../]
+[]
+
+[Kernels]
+  [./TensorMechanics]
+    displacements = 'disp_x disp_y disp_z'
+    use_displaced_mesh = true
+    add_variables = true
+    block = '1'
+  [../]
+[]
+
+[AuxKernels]
+  [./tempfuncaux]
+    type = FunctionAux
+    variable = temp
+    function = temperature_load
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[BCs]
+  [./x_left]
+    type = DirichletBC
+    variable = disp_x
+    boundary = left
+    value = 0.0
+  [../]
+  [./y_left]
+    type = DirichletBC
+    variable = disp_y
+    boundary = left
+    value = 0.0
+  [../]
+  [./z_left]
+    type = DirichletBC
+    variable = disp_z
+    boundary = left
+    value = 0.0
+  [../]
+[]
+
+[Adaptivity]
+  marker = melt_pool
+  max_h_level = 1
+  [./Markers]
+    [./melt_pool]
+      type = HeatSourceMarker
+      variable = temp
+      rx = 0.5
+      ry = 0.5
+      rz = 0.5
+      function_x = path_x
+      function_y = path_y
+      function_z = path_z
+    [../]
+  [../]
+[]
+
+[Postprocessors]
+  [./active_volume]
+    type = VolumePostprocessor
+    block = '1'
+  [../]
+[]
+
+[Materials]
+  [./crysp]
+    type = FiniteStrainCrystalPlasticityThermal
+    block = '1'
+    gtol = 1e-2
+    slip_sys_file_name = input_slip_sys.txt # no need to normalize vectors
+    nss = 12 # Number of slip systems
+    num_slip_sys_flowrate_props = 2 #Number of flow rate properties in a slip system
+    flowprops = '1 4 0.001 0.1 5 8 0.001 0.1 9 12 0.001 0.1' # slip rate equations parameters
+# Calibrated by comparing with Fig 2b in:
+# Wen Chen et al.
+# Microscale residual stresses in additively
+# manufactured stainless steel
+# NATURE COMMUNICATIONS (2019) 10:4338
+    hprops = '1.0 3839.0 213.0 302.0 2.5' # hardening properties
+    gprops = '1 12 213.0' # initial values of slip system resistances (start_slip_sys, end_slip_sys, value)
+    tan_mod_type = exact
+    thermal_expansion = '0.0e-6'
+    reference_temperature = '298.0'
+    temp = temp
+    maxiter = 250
+    maxitergss = 250
+    maximum_substep_iteration = 6
+    gen_random_stress_flag = true
+# Calibrated using table 1 in:
+# M.R. DAYMOND and P.J. BOUCHARD
+# Elastoplastic Deformation of 316 Stainless Steel Under
+# Tensile Loading at Elevated Temperatures
+# METALLURGICAL AND MATERIALS TRANSACTIONS A
+# VOLUME 37A, JUNE 2006—1873
+	dCRSS_dT_A = 0.53
+	dCRSS_dT_B = 0.47
+	dCRSS_dT_C = 0.008
+# Calibrated using table 1 in:
+# W.Jiang, Y.Zhang and W.Woo
+# Using heat sink technology to decrease residual stress
+# in 316L stainless steel welding joint:Finite element simulation
+# Int.J.Press.Vessel.Pip.
+# VOLUME 92, pp.56-62, 2012
+    dCTE_dT='0.0'
+  [../]
+  [./elasticity_tensor]
+    type = ComputeElasticityTensorCPGrain
+# Elastic constants of 316L SS from:
+# Clausen, B., Lorentzen, T. and Leffers, T.
+# Self-consistent modelling of the plastic
+# deformation of FCC polycrystals and its implications for diffraction
+# measurements of internal stresses.
+# Acta Mater. 46, 3087–3098 (1998).
+    C_ijkl = '2.046e5 1.377e5 1.377e5 2.046e5 1.377e5 2.046e5 1.262e5 1.262e5 1.262e5'
+    fill_method = symmetric9
+    read_prop_user_object = prop_read
+    temp = temp
+    dC11_dT = 0.0004415
+    dC12_dT = 0.0003275
+    dC44_dT = 0.0004103
+    block = '1'
+  [../]
+  [./strain]
+    type = ComputeFiniteStrain
+    displacements = 'disp_x disp_y disp_z'
+    block = '1'
+  [../]
+  [./dummy_mat_inactive]
+    type = GenericConstantMaterial
+    prop_names = 'dummy_mat'
+    prop_values = '0.0'
+  	block = '2'
+  [../]
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'PJFNK'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  line_search = 'none'
+  nl_rel_tol = 1e-8
+  nl_abs_tol = 1e-6
+
+  start_time = 0.0
+  end_time = 3.0
+  dt = 1.0
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -127,6 +127,7 @@
     type = LaserTempReadFile
 	temperature_file_name = 'temperature1El.txt'
 	temperature_num_step = 9
+	temperature_time_step = 1.0
   [../]
   [./activated_elem_uo]
     type = ActDeactElementsMelting
@@ -163,7 +164,6 @@
     type = TempActDeactElemsAux
     variable = temp
     temperature_read_user_object = temperature_read
-	temperature_time_step = 1.0
   [../]
 []
 
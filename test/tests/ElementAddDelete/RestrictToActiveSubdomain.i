@@ -0,0 +1,106 @@
+# DoFs shared by a newly activated element and an element that was already active
+# the initial condition u = t is projected on the newly activated element,
+# the problem is not solved so u keeps its values in the active elements
+# the second element, x in [1, 2], is activated at t = 1
+# with restrict_to_active_subdomain = true the nodes at x = 1 keep u = 0
+# and the average of u over the active elements is 0.25,
+# otherwise the initial condition overwrites them with u = 1
+# and the average is 0.75
+
+[Problem]
+  kernel_coverage_check = false
+  solve = false
+[]
+
+[Mesh]
+  [./gen]
+    type = GeneratedMeshGenerator
+    dim = 2
+    xmin = 0.0
+    xmax = 2.0
+    ymin = 0.0
+    ymax = 1.0
+    nx = 2
+    ny = 1
+    elem_type = QUAD4
+  [../]
+  [./substrate]
+    input = gen
+    type = SubdomainBoundingBoxGenerator
+    bottom_left = '0.0 0.0 -1.0'
+    top_right = '1.0 1.0 1.0'
+    block_id = 1
+  [../]
+  [./deposit]
+    input = substrate
+    type = SubdomainBoundingBoxGenerator
+    bottom_left = '1.0 0.0 -1.0'
+    top_right = '2.0 1.0 1.0'
+    block_id = 2
+  [../]
+  [./sidesets]
+    input = deposit
+    type = SideSetsAroundSubdomainGenerator
+    normal = '1 0 0'
+    block = 1
+    new_boundary = 'moving_interface'
+  [../]
+[]
+
+[Variables]
+  [./u]
+    block = '1'
+    [./InitialCondition]
+      type = FunctionIC
+      function = 't'
+    [../]
+  [../]
+[]
+
+[UserObjects]
+  [./toolpath]
+    type = Toolpath
+    toolpath_file = 'toolpath_deposition.csv'
+  [../]
+  [./schedule]
+    type = ActivationSchedule
+    toolpath = toolpath
+    deposition_radii = '0.25 0.25 0.25'
+  [../]
+  [./activated_elem_uo]
+    type = ActDeactElementsMelting
+    execute_on = timestep_begin
+    activation_schedule = schedule
+    active_subdomain_id = 1
+    deactive_subdomain_id = 2
+    expand_boundary_name = 'moving_interface'
+    restrict_to_active_subdomain = true
+  [../]
+[]
+
+[Postprocessors]
+  # node at x = 1, y = 0
+  [./u_shared]
+    type = NodalVariableValue
+    variable = u
+    nodeid = 1
+    execute_on = 'initial timestep_end'
+  [../]
+  [./u_average]
+    type = ElementAverageValue
+    variable = u
+    block = '1'
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  start_time = 0.0
+  end_time = 2.0
+  dt = 1.0
+[]
+
+[Outputs]
+  csv = true
+[]
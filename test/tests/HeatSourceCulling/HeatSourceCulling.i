@@ -0,0 +1,129 @@
+# Culling of the ellipsoidal heat sources far from the source centre
+# source at x = 0 with radii 1 on 8 elements of size 1,
+# one quadrature point at the element centroid
+# the exponent of the Gaussian at the centroid is 3 x^2
+# with the default cutoff_exponent = 40 the bounding box is |x| < 3.65:
+# element 0 (x = 0.5) and element 2 (x = 2.5) are inside,
+# element 4 (x = 4.5) is outside and is skipped
+# heat = 6 sqrt(3) / pi^1.5 exp(-3 x^2):
+# 0.88159, 1.3427e-08 and 0 (exp(-60.75) is below the CSVDiff tolerance)
+# the same values are obtained with a huge cutoff_exponent (no culling)
+# and with the double ellipsoid with equal front and rear axes
+# the level set is activated where the ellipsoid function
+# is larger than the threshold 0.01, that is 3 x^2 < 5.229:
+# element 0 is activated, element 1 (x = 1.5) is in the bounding box
+# |x| < 1.32 but not activated, element 2 is outside and is skipped
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 8
+  xmax = 8.0
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Variables]
+  [./temp]
+  [../]
+[]
+
+[AuxVariables]
+  [./heat]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./level_set]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[AuxKernels]
+  [./heat]
+    type = ADMaterialRealAux
+    variable = heat
+    property = volumetric_heat
+    execute_on = timestep_end
+  [../]
+  [./level_set]
+    type = MaterialRealAux
+    variable = level_set
+    property = level_set
+    execute_on = timestep_end
+  [../]
+[]
+
+[Materials]
+  active = 'volumetric_heat level_set'
+  [./volumetric_heat]
+    type = TimeDepEllipsoidHeatSource
+    rx = 1.0
+    ry = 1.0
+    rz = 1.0
+    power = 1.0
+    function_t = 1.0
+  [../]
+  [./double_ellipsoid]
+    type = FunctionPathDoubleEllipsoidHS
+    a_f = 1.0
+    a_r = 1.0
+    b = 1.0
+    c = 1.0
+    power = 1.0
+  [../]
+  [./level_set]
+    type = FunctionPathEllipsoidMaterial
+    rx = 1.0
+    ry = 1.0
+    rz = 1.0
+    level_set_activation_threshold = 0.01
+  [../]
+[]
+
+[Postprocessors]
+  [./heat0]
+    type = ElementalVariableValue
+    variable = heat
+    elementid = 0
+  [../]
+  [./heat2]
+    type = ElementalVariableValue
+    variable = heat
+    elementid = 2
+  [../]
+  [./heat4]
+    type = ElementalVariableValue
+    variable = heat
+    elementid = 4
+  [../]
+  [./level_set0]
+    type = ElementalVariableValue
+    variable = level_set
+    elementid = 0
+  [../]
+  [./level_set1]
+    type = ElementalVariableValue
+    variable = level_set
+    elementid = 1
+  [../]
+  [./level_set2]
+    type = ElementalVariableValue
+    variable = level_set
+    elementid = 2
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  [./Quadrature]
+    type = GAUSS
+    order = CONSTANT
+  [../]
+[]
+
+[Outputs]
+  csv = true
+[]
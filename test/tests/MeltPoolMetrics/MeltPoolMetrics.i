@@ -0,0 +1,63 @@
+# melt pool metrics of a prescribed temperature field
+# T = 2000 - 100 r^2 with r the distance from the source at (2, 0, 0)
+# on a mesh of unit cubes below the surface z = 0
+# the nodes above the melting temperature 1750 have r^2 < 2.5:
+# x in [1, 3], y in [-1, 1], z in [-1, 0]
+# therefore length = 2, width = 2 and depth = 1
+# the average r^2 over the nodes of the four elements
+# touching the source is 1.5, that is T = 1850,
+# and 3.5 or more for the other elements, that is T <= 1650:
+# the melt pool volume is 4
+# the peak temperature is 2000 at the source
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 4
+  ny = 4
+  nz = 2
+  xmin = 0.0
+  xmax = 4.0
+  ymin = -2.0
+  ymax = 2.0
+  zmin = -2.0
+  zmax = 0.0
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Variables]
+  [./temp]
+    [./InitialCondition]
+      type = FunctionIC
+      function = temperature
+    [../]
+  [../]
+[]
+
+[Functions]
+  [./temperature]
+    type = ParsedFunction
+    value = '2000.0 - 100.0 * ((x - 2.0)^2 + y^2 + z^2)'
+  [../]
+[]
+
+[VectorPostprocessors]
+  [./melt_pool]
+    type = MeltPoolMetrics
+    temperature = temp
+    melting_temperature = 1750.0
+    search_radius = 2.0
+    function_x = 2.0
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Outputs]
+  csv = true
+[]
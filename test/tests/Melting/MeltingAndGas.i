@@ -69,6 +69,7 @@
     type = LaserTempReadFile
 	temperature_file_name = 'temperature1El.txt'
 	temperature_num_step = 8
+	temperature_time_step = 1.0
   [../]
 []
 
@@ -96,7 +97,6 @@
     type = LaserTempReadFileAux
     variable = temp
     temperature_read_user_object = temperature_read
-	temperature_time_step = 1.0
     block = 'ANY_BLOCK_ID 0'
   [../]
 []
@@ -195,7 +195,6 @@
     dC44_dT = 0.0004103
 	residual_stiffness = 0.001
 	temperature_read_user_object = temperature_read
-	temperature_time_step = 1.0
   [../]
   [./strain]
     type = ComputeFiniteStrain
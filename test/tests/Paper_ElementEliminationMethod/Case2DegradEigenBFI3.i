@@ -392,6 +392,7 @@
     type = LaserTempReadFile
     temperature_file_name = 'Temperature8umToRT.txt'
     temperature_num_step = 80
+    temperature_time_step = 45.0
   [../]
   
   [./activated_elem_uo]
@@ -446,7 +447,6 @@
     type = LaserTempReadFileAux
     variable = temp
     temperature_read_user_object = temperature_read
-    temperature_time_step = 45.0
 	degrade_eigenstrain = true
   [../]
   
@@ -454,7 +454,6 @@
     type = TempActDeactElemsCFDStepsAux
     variable = phase_temp
     temperature_read_user_object = temperature_read
-    temperature_time_step = 45.0
   [../]
 
   [./stress_xx]
@@ -978,7 +977,6 @@
     dC44_dT = 0.0004103
     residual_stiffness = 0.01
     temperature_read_user_object = temperature_read
-    temperature_time_step = 45.0
     reference_temperature = '303.0'
     activate_elems = true
     block = '1'
@@ -296,6 +296,7 @@
     type = LaserTempReadFile
     temperature_file_name = 'Temperature4umToRT2.txt'
     temperature_num_step = 2 #198
+    temperature_time_step = 0.000400
   [../]
 []
 
@@ -401,7 +402,6 @@
     type = LaserTempReadFileAux
     variable = temp
     temperature_read_user_object = temperature_read
-    temperature_time_step = 0.000400
   [../]
 
   [./stress_xx]
@@ -867,7 +867,6 @@
     dC44_dT = 0.0004103
         residual_stiffness = 0.01
         temperature_read_user_object = temperature_read
-        temperature_time_step = 0.000400
   [../]
   [./strain]
     type = ComputeFiniteStrain
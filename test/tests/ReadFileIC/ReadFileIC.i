@@ -0,0 +1,123 @@
+# Two phase fields read once from a 5 x 4 x 3 structured grid
+# and interpolated trilinearly on a 3 x 5 x 3 mesh whose nodes
+# are not grid points: the grid values are eta0 = x + 1.5 y and eta1 = 1 - z,
+# which are linear and therefore interpolated exactly
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 3
+  ny = 5
+  nz = 3
+  xmax = 1.0
+  ymax = 1.0
+  zmax = 1.0
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Variables]
+  [./eta0]
+  [../]
+  [./eta1]
+  [../]
+[]
+
+[UserObjects]
+  [./grid]
+    type = StructuredGridReadFile
+    file_name = 'grid.txt'
+    ncolumns = 2
+    nx = 5
+    ny = 4
+    nz = 3
+    element_size_x = 0.25
+    element_size_y = 0.333333333333333
+    element_size_z = 0.5
+    interpolation = trilinear
+  [../]
+[]
+
+[ICs]
+  [./eta0_ic]
+    type = ReadFileIC
+    variable = eta0
+    grid_data = grid
+    op = 0
+  [../]
+  [./eta1_ic]
+    type = ReadFileIC
+    variable = eta1
+    grid_data = grid
+    op = 1
+  [../]
+[]
+
+[Functions]
+  [./eta0_exact]
+    type = ParsedFunction
+    value = 'x + 1.5 * y'
+  [../]
+  [./eta1_exact]
+    type = ParsedFunction
+    value = '1.0 - z'
+  [../]
+[]
+
+[Postprocessors]
+  [./eta0_max]
+    type = NodalExtremeValue
+    variable = eta0
+    execute_on = 'initial timestep_end'
+  [../]
+  [./eta1_min]
+    type = NodalExtremeValue
+    variable = eta1
+    value_type = min
+    execute_on = 'initial timestep_end'
+  [../]
+  [./eta0_average]
+    type = ElementAverageValue
+    variable = eta0
+    execute_on = 'initial timestep_end'
+  [../]
+  [./eta1_average]
+    type = ElementAverageValue
+    variable = eta1
+    execute_on = 'initial timestep_end'
+  [../]
+  [./eta0_point]
+    type = PointValue
+    variable = eta0
+    point = '0.4 0.3 0.2'
+    execute_on = 'initial timestep_end'
+  [../]
+  [./eta1_point]
+    type = PointValue
+    variable = eta1
+    point = '0.4 0.3 0.2'
+    execute_on = 'initial timestep_end'
+  [../]
+  [./eta0_error]
+    type = ElementL2Error
+    variable = eta0
+    function = eta0_exact
+    execute_on = 'initial timestep_end'
+  [../]
+  [./eta1_error]
+    type = ElementL2Error
+    variable = eta1
+    function = eta1_exact
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -78,6 +78,7 @@
     type = LaserTempReadFile
 	temperature_file_name = 'temperature1El.txt'
 	temperature_num_step = 5
+	temperature_time_step = 1.0
   [../]
 []
 
@@ -125,7 +126,6 @@
     type = LaserTempReadFileAux
     variable = temp
     temperature_read_user_object = temperature_read
-	temperature_time_step = 1.0
     block = 'ANY_BLOCK_ID 0'
   [../]
 []
@@ -223,7 +223,6 @@
     dC12_dT = 0.0003275
     dC44_dT = 0.0004103
 	temperature_read_user_object = temperature_read
-	temperature_time_step = 1.0
   [../]
   [./strain]
     type = ComputeFiniteStrain
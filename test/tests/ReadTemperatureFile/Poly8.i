@@ -110,6 +110,7 @@
     type = LaserTempReadFile
 	temperature_file_name = 'temperature.txt'
 	temperature_num_step = 3
+	temperature_time_step = 0.1
   [../]
 []
 
@@ -126,7 +127,6 @@
     type = LaserTempReadFileAux
     variable = temp
     temperature_read_user_object = temperature_read
-	temperature_time_step = 0.1
     block = 'ANY_BLOCK_ID 0'
   [../]
 
@@ -0,0 +1,56 @@
+# waypoints of a toolpath read from G-code
+# G1 and G0 are modal, words can be written without spaces,
+# G4 is a dwell and M5 switches the laser off
+# G21, G92, E, T and the M104 temperature block are ignored
+# with F600 and the default feed_rate_factor the speed is 10
+# the power of each waypoint is the power of the segment starting there
+# the same input reads toolpath.csv with cli_args
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 1
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Variables]
+  [./temp]
+  [../]
+[]
+
+[UserObjects]
+  [./toolpath]
+    type = Toolpath
+    toolpath_file = 'toolpath.gcode'
+    file_format = gcode
+  [../]
+[]
+
+# power is taken from the toolpath
+[Materials]
+  [./volumetric_heat]
+    type = TimeDepEllipsoidHeatSource
+    rx = 1.0
+    ry = 1.0
+    rz = 1.0
+    toolpath = toolpath
+  [../]
+[]
+
+[VectorPostprocessors]
+  [./waypoints]
+    type = ToolpathWaypoints
+    toolpath = toolpath
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Outputs]
+  csv = true
+[]
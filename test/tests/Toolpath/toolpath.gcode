@@ -0,0 +1,14 @@
+; two laser tracks joined by a travel move and a dwell
+%
+G21
+G90 M3 S200
+M104 S210 ; printer temperature, ignored
+G92 X5 E0 ; ignored
+G1 X1 F600 E0.5 T0 ; first track
+Y1 (modal G1)
+G0X2Y1
+G4 P100
+G91 G1 X0 Y-1 S100
+M5
+X1
+M30
@@ -0,0 +1,3 @@
+; arcs are not supported
+G1 X1 F600
+G2 X2 Y1 I1 J0
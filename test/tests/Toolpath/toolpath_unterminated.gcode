@@ -0,0 +1,3 @@
+G1 X1 F600
+G1 X2 (second track
+G1 X3
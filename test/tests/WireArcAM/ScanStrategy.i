@@ -0,0 +1,116 @@
+# two tracks of a ScanStrategy on a line of ten unit elements
+# with one quadrature point at the element centre
+# the first track starts at x = 0.5 and is 2 long,
+# the second track starts at x = 7.5 and is 1 long
+# the velocity is 1 and dt = 1, therefore the source
+# is at x = 1.5, 2.5 at t = 1, 2, it switches track at t = 3
+# and it is at x = 7.5, 8.5 at t = 3, 4
+# at t = 5 both tracks are over and the source is switched off
+# the temperature postprocessor is always below the threshold
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 10
+  xmax = 10.0
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Variables]
+  [./temp]
+  [../]
+[]
+
+[AuxVariables]
+  [./level_set_var]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./heat]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[UserObjects]
+  [./scan]
+    type = ScanStrategy
+    velocity = '1.0 0.0 0.0'
+    init_x_coords = '0.5 7.5'
+    init_y_coords = '0.0 0.0'
+    init_z_coords = '0.0 0.0'
+    scan_length = '2.0 1.0'
+    temperature_pp = temperature_pp
+    threshold_temperature = 1.0
+  [../]
+[]
+
+# each element is activated when the centre of the source
+# is in the element, the next centre is too far
+[AuxKernels]
+  [./deposition]
+    type = VelocityEllipsoidAux
+    variable = level_set_var
+    rx = 1.0
+    ry = 1.0
+    rz = 1.0
+    scan_strategy = scan
+    execute_on = timestep_end
+  [../]
+  [./heat]
+    type = ADMaterialRealAux
+    variable = heat
+    property = volumetric_heat
+    execute_on = timestep_end
+  [../]
+[]
+
+[Materials]
+  [./volumetric_heat]
+    type = VelocityEllipsoidHeatSource
+    rx = 1.0
+    ry = 1.0
+    rz = 1.0
+    power = 1.0
+    scan_strategy = scan
+  [../]
+[]
+
+# heat_track0 and heat_track1 are the heat source
+# in the element at the start of each track
+[Postprocessors]
+  [./temperature_pp]
+    type = Receiver
+    default = 0.0
+  [../]
+  [./deposited]
+    type = ElementAverageValue
+    variable = level_set_var
+  [../]
+  [./heat_track0]
+    type = PointValue
+    variable = heat
+    point = '1.5 0.0 0.0'
+  [../]
+  [./heat_track1]
+    type = PointValue
+    variable = heat
+    point = '7.5 0.0 0.0'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  dt = 1.0
+  num_steps = 5
+  [./Quadrature]
+    order = CONSTANT
+  [../]
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,94 @@
+# Euler angles of 64 voronoi grains on a 10x10x10 mesh
+# the grain of each element is found with bins of grain centers
+# and compared with the loop over all the grain centers (grain_search = brute_force)
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 10
+  ny = 10
+  nz = 10
+  xmax = 2.0
+  ymax = 1.0
+  zmax = 1.5
+  elem_type = HEX8
+[]
+
+[Problem]
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./euler1]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./euler2]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./euler3]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[UserObjects]
+  [./prop_read]
+    type = GrainPropertyReadFile
+    prop_file_name = 'voronoi_euler.txt'
+    # Enter file data as prop#1, prop#2, .., prop#nprop
+    nprop = 3
+    ngrain = 64
+    read_type = grain
+  [../]
+[]
+
+[AuxKernels]
+  [./euler1]
+    type = MaterialRealVectorValueAux
+    variable = euler1
+    property = Euler_angles
+    component = 0
+    execute_on = timestep_end
+  [../]
+  [./euler2]
+    type = MaterialRealVectorValueAux
+    variable = euler2
+    property = Euler_angles
+    component = 1
+    execute_on = timestep_end
+  [../]
+  [./euler3]
+    type = MaterialRealVectorValueAux
+    variable = euler3
+    property = Euler_angles
+    component = 2
+    execute_on = timestep_end
+  [../]
+[]
+
+[Materials]
+  [./elasticity_tensor]
+    type = ComputeElasticityTensorCPGrain
+    C_ijkl = '1.684e5 1.214e5 1.214e5 1.684e5 1.214e5 1.684e5 0.754e5 0.754e5 0.754e5'
+    fill_method = symmetric9
+    read_prop_user_object = prop_read
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Outputs]
+  [./out]
+    type = Exodus
+  [../]
+[]
@@ -0,0 +1,65 @@
+# thermal sub-app with small time steps
+# the temperature is transferred to the mechanical parent app
+# that takes large time steps
+
+[Mesh]
+  [./polycrystal_generated_mesh]
+    type = GeneratedMeshGenerator
+    dim = 3
+    nx = 1
+    ny = 1
+    nz = 1
+    xmax = 1.0
+    ymax = 1.0
+    zmax = 1.0
+    elem_type = HEX8
+  [../]
+[]
+
+[Variables]
+  [./temperature]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 303.0
+  [../]
+[]
+
+[Kernels]
+  [./heat_conduction]
+    type = Diffusion
+    variable = temperature
+  [../]
+  [./heat_time_derivative]
+    type = TimeDerivative
+    variable = temperature
+  [../]
+[]
+
+[Functions]
+  [./temperature_function]
+    type = PiecewiseLinear
+    x = '0 1700'
+    y = '303 2003'
+  [../]
+[]
+
+[BCs]
+  [./surface_temperature]
+    type = FunctionDirichletBC
+    variable = temperature
+    boundary = 'left right bottom top back front'
+    function = temperature_function
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  nl_abs_tol = 1e-8
+  nl_rel_tol = 1e-8
+  dt = 0.1
+[]
+
+[Outputs]
+  exodus = false
+[]